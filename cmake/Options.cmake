@@ -2,3 +2,4 @@
 
 option(BUILD_TESTING "Build & run automated tests." OFF)
 option(BUILD_DOCUMENTATION "Build doxygen documentation." OFF)
+option(BUILD_BENCHMARKS "Build performance benchmark programs." OFF)
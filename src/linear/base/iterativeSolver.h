@@ -0,0 +1,184 @@
+#pragma once
+
+/// \file iterativeSolver.h
+///
+/// Implementation details shared by the iterative (Krylov subspace) solvers.
+///
+/// The solvers only access the system matrix through its product with a vector, so that any \em operator
+/// providing
+/// \code{.cpp}
+/// void Apply( const VectorT& i_x, VectorT& o_y ) const; // y = A * x
+/// \endcode
+/// may stand in for the matrix, such as a sparse or implicitly defined one.  A \ref Matrix is accepted as an
+/// operator as-is.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+LINEAR_NS_OPEN
+
+/// Check if \p OperatorT provides \p Apply( x, y ) for vectors of type \p VectorT.
+template < typename OperatorT, typename VectorT, typename = void >
+struct _HasApply : std::false_type
+{
+};
+
+template < typename OperatorT, typename VectorT >
+struct _HasApply< OperatorT,
+                  VectorT,
+                  std::void_t< decltype( std::declval< const OperatorT& >().Apply( std::declval< const VectorT& >(),
+                                                                                    std::declval< VectorT& >() ) ) > >
+    : std::true_type
+{
+};
+
+/// Compute \f$y = Ax\f$, where \f$A\f$ is the operator \p i_operator.
+template < typename OperatorT, typename VectorT >
+inline void _ApplyOperator( const OperatorT& i_operator, const VectorT& i_x, VectorT& o_y )
+{
+    if constexpr ( _HasApply< OperatorT, VectorT >::value )
+    {
+        i_operator.Apply( i_x, o_y );
+    }
+    else
+    {
+        static_assert( std::is_same< OperatorT, typename OperatorT::MatrixType >::value,
+                       "The operator must either provide Apply( x, y ), or be a Matrix." );
+        static_assert( OperatorT::ColumnCount() == VectorT::RowCount() );
+        for ( int rowIndex = 0; rowIndex < OperatorT::RowCount(); ++rowIndex )
+        {
+            o_y[ rowIndex ] = _DotProduct( &i_operator( rowIndex, 0 ), &i_x[ 0 ], VectorT::RowCount() );
+        }
+    }
+}
+
+/// Compute the Euclidean norm of the column vector \p i_vector.
+template < typename VectorT >
+inline typename VectorT::ValueType _VectorNorm( const VectorT& i_vector )
+{
+    return std::sqrt( _DotProduct( &i_vector[ 0 ], &i_vector[ 0 ], VectorT::RowCount() ) );
+}
+
+/// \class _IterativeSolver
+///
+/// The stopping criteria and the statistics of the last solve, common to the iterative solvers.
+///
+/// An iteration stops once the norm of the residual \f$||b - Ax||\f$ is at or below the tolerance relative to
+/// \f$||b||\f$, or after the maximum number of iterations.
+template < typename VectorT >
+class _IterativeSolver
+{
+public:
+    static_assert( VectorT::ColumnCount() == 1 );
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename VectorT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the solution and right-hand side vectors.
+    using VectorType = VectorT;
+
+    /// Set the tolerance on the residual norm, relative to the norm of the right-hand side.
+    ///
+    /// \param i_tolerance the relative tolerance.  Defaults to \f$\sqrt{\epsilon}\f$.
+    inline void SetTolerance( const ValueType& i_tolerance )
+    {
+        m_tolerance = i_tolerance;
+    }
+
+    /// Get the tolerance on the residual norm, relative to the norm of the right-hand side.
+    ///
+    /// \return the relative tolerance.
+    inline ValueType Tolerance() const
+    {
+        return m_tolerance;
+    }
+
+    /// Set the maximum number of iterations of a solve.
+    ///
+    /// \param i_maxIterations the maximum number of iterations.  Defaults to twice the size of the system.
+    inline void SetMaxIterations( int i_maxIterations )
+    {
+        m_maxIterations = i_maxIterations;
+    }
+
+    /// Get the maximum number of iterations of a solve.
+    ///
+    /// \return the maximum number of iterations.
+    inline int MaxIterations() const
+    {
+        return m_maxIterations;
+    }
+
+    /// Get the number of iterations performed by the last solve.
+    ///
+    /// \return the number of iterations.
+    inline int IterationCount() const
+    {
+        return m_iterationCount;
+    }
+
+    /// Get the norm of the residual \f$||b - Ax||\f$ at the end of the last solve.
+    ///
+    /// \return the residual norm.
+    inline ValueType ResidualNorm() const
+    {
+        return m_residualNorm;
+    }
+
+protected:
+    _IterativeSolver() = default;
+
+    /// Begin a solve for the right-hand side \p i_rhs.
+    ///
+    /// \return the absolute residual norm at which to stop, or \p 0 if \p i_rhs is zero, in which case
+    /// \p io_solution is set to the zero solution.
+    ValueType _Begin( const VectorT& i_rhs, VectorT& io_solution )
+    {
+        m_iterationCount = 0;
+        m_residualNorm   = 0;
+
+        const ValueType rhsNorm = _VectorNorm( i_rhs );
+        if ( rhsNorm == 0 )
+        {
+            io_solution = VectorT();
+        }
+        return m_tolerance * rhsNorm;
+    }
+
+    /// Compute the residual \p o_residual of \p i_solution, and record its norm.
+    template < typename OperatorT >
+    ValueType _Residual( const OperatorT& i_operator,
+                         const VectorT&   i_rhs,
+                         const VectorT&   i_solution,
+                         VectorT&         o_residual )
+    {
+        _ApplyOperator( i_operator, i_solution, o_residual );
+        for ( int index = 0; index < VectorT::RowCount(); ++index )
+        {
+            o_residual[ index ] = i_rhs[ index ] - o_residual[ index ];
+        }
+
+        m_residualNorm = _VectorNorm( o_residual );
+        return m_residualNorm;
+    }
+
+    ValueType m_tolerance     = std::sqrt( std::numeric_limits< ValueType >::epsilon() );
+    int       m_maxIterations = 2 * VectorT::RowCount();
+
+    int       m_iterationCount = 0;
+    ValueType m_residualNorm   = 0;
+};
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,230 @@
+#pragma once
+
+/// \file matrixBareiss.h
+///
+/// Fraction-free (Bareiss) elimination implementation details, for matrices of integral values.
+///
+/// Gaussian elimination divides by the pivots, which truncates when the values are integers.  Bareiss elimination
+/// instead cross-multiplies the rows, then divides by the previous pivot:
+/// \f[
+/// a_{ij} \leftarrow \frac{a_{kk}a_{ij} - a_{ik}a_{kj}}{p}
+/// \f]
+/// By Sylvester's identity, every entry is then a minor of the original matrix, so the division is exact and the
+/// entries grow no larger than the minors (bounded by Hadamard's inequality) rather than exponentially.  The last
+/// pivot of a square matrix is its determinant, up to the sign of the row exchanges.
+///
+/// The numerator is computed in an intermediate type of twice the width of the value type, such that only the
+/// quotient needs to be checked for overflow.  64-bit values use \p __int128 intermediates where the compiler
+/// provides them, unless \ref LINEAR_BAREISS_INT128 is defined to \p 0.  Otherwise, every operation is checked in
+/// 64 bits, which conservatively reports overflow of the products even where their exact quotient would fit.
+
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/pivoting.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/// \def LINEAR_BAREISS_INT128
+///
+/// Whether fraction-free elimination of 64-bit values computes its intermediates in 128-bit integers.  Defaults to
+/// \p 1 where the compiler supports \p __int128.
+#ifndef LINEAR_BAREISS_INT128
+#ifdef __SIZEOF_INT128__
+#define LINEAR_BAREISS_INT128 1
+#else
+#define LINEAR_BAREISS_INT128 0
+#endif
+#endif
+
+LINEAR_NS_OPEN
+
+/// The intermediate type of the fraction-free elimination of values of type \p ValueT.
+template < typename ValueT >
+using _BareissIntermediate = typename std::conditional< sizeof( ValueT ) <= 4,
+                                                        std::int64_t,
+#if LINEAR_BAREISS_INT128
+                                                        typename std::conditional< sizeof( ValueT ) <= 8,
+                                                                                   __int128,
+                                                                                   ValueT >::type
+#else
+                                                        ValueT
+#endif
+                                                        >::type;
+
+/// Compute \f$ab\f$ into \p o_product.
+///
+/// \return \p false if the product overflows \p ValueT, in which case \p o_product is un-defined.
+template < typename ValueT >
+inline bool _CheckedMultiply( ValueT i_a, ValueT i_b, ValueT& o_product )
+{
+    constexpr ValueT minValue = std::numeric_limits< ValueT >::min();
+    constexpr ValueT maxValue = std::numeric_limits< ValueT >::max();
+    if ( i_a > 0 ? ( i_b > 0 ? i_a > maxValue / i_b : i_b < minValue / i_a )
+                 : ( i_b > 0 ? i_a < minValue / i_b : i_a != 0 && i_b < maxValue / i_a ) )
+    {
+        return false;
+    }
+
+    o_product = i_a * i_b;
+    return true;
+}
+
+/// Compute \f$a - b\f$ into \p o_difference.
+///
+/// \return \p false if the difference overflows \p ValueT, in which case \p o_difference is un-defined.
+template < typename ValueT >
+inline bool _CheckedSubtract( ValueT i_a, ValueT i_b, ValueT& o_difference )
+{
+    if ( ( i_b > 0 && i_a < std::numeric_limits< ValueT >::min() + i_b ) ||
+         ( i_b < 0 && i_a > std::numeric_limits< ValueT >::max() + i_b ) )
+    {
+        return false;
+    }
+
+    o_difference = i_a - i_b;
+    return true;
+}
+
+/// Compute the exact quotient \f$(ab - cd) / p\f$ of a fraction-free elimination step into \p o_result.
+///
+/// \return \p false if the result, or an intermediate, overflows \p ValueT.
+template < typename ValueT >
+inline bool
+_BareissStep( ValueT i_a, ValueT i_b, ValueT i_c, ValueT i_d, ValueT i_previousPivot, ValueT& o_result )
+{
+    using IntermediateT = _BareissIntermediate< ValueT >;
+
+    IntermediateT numerator;
+    if constexpr ( sizeof( IntermediateT ) >= 2 * sizeof( ValueT ) )
+    {
+        // Neither product, nor their difference, can overflow twice the width.
+        numerator = IntermediateT( i_a ) * IntermediateT( i_b ) - IntermediateT( i_c ) * IntermediateT( i_d );
+    }
+    else
+    {
+        IntermediateT productAB;
+        IntermediateT productCD;
+        if ( !_CheckedMultiply< IntermediateT >( i_a, i_b, productAB ) ||
+             !_CheckedMultiply< IntermediateT >( i_c, i_d, productCD ) ||
+             !_CheckedSubtract( productAB, productCD, numerator ) ||
+             ( i_previousPivot == -1 && numerator == std::numeric_limits< IntermediateT >::min() ) )
+        {
+            return false;
+        }
+    }
+
+    const IntermediateT quotient = numerator / IntermediateT( i_previousPivot );
+    if ( quotient < IntermediateT( std::numeric_limits< ValueT >::min() ) ||
+         quotient > IntermediateT( std::numeric_limits< ValueT >::max() ) )
+    {
+        return false;
+    }
+
+    o_result = ValueT( quotient );
+    return true;
+}
+
+/// Reduce \p io_matrix to row echelon form in-place via fraction-free elimination, selecting the first non-zero
+/// entry of each column as its pivot.
+///
+/// The entries below the pivots are zeroed, and the entries right of the last pivot column of each row are
+/// minors of the original matrix.
+///
+/// \param io_matrix the matrix of integral values to reduce.
+/// \param o_rank the number of pivots.
+/// \param o_rowExchanges the number of row exchanges performed.
+///
+/// \return \p false if an entry overflows the value type, in which case \p io_matrix and \p o_rank are un-defined.
+template < typename MatrixT >
+inline bool _MatrixBareiss( MatrixT& io_matrix, int& o_rank, int& o_rowExchanges )
+{
+    using ValueT = typename MatrixT::ValueType;
+    static_assert( std::is_integral< ValueT >::value && std::is_signed< ValueT >::value,
+                   "Fraction-free elimination requires signed integral values." );
+
+    ValueT previousPivot = 1;
+    o_rank               = 0;
+    o_rowExchanges       = 0;
+    for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount() && o_rank < MatrixT::RowCount(); ++columnIndex )
+    {
+        const int pivotRowIndex = _FindAndPerformRowExchange< ZeroPivot >( o_rank, columnIndex, io_matrix );
+        if ( pivotRowIndex == -1 )
+        {
+            continue;
+        }
+        else if ( pivotRowIndex != o_rank )
+        {
+            o_rowExchanges++;
+        }
+
+        const ValueT pivot = io_matrix( o_rank, columnIndex );
+        for ( int rowIndex = o_rank + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            const ValueT factor = io_matrix( rowIndex, columnIndex );
+            for ( int updateIndex = columnIndex + 1; updateIndex < MatrixT::ColumnCount(); ++updateIndex )
+            {
+                if ( !_BareissStep( pivot,
+                                    io_matrix( rowIndex, updateIndex ),
+                                    factor,
+                                    io_matrix( o_rank, updateIndex ),
+                                    previousPivot,
+                                    io_matrix( rowIndex, updateIndex ) ) )
+                {
+                    return false;
+                }
+            }
+            io_matrix( rowIndex, columnIndex ) = 0;
+        }
+
+        previousPivot = pivot;
+        o_rank++;
+    }
+
+    return true;
+}
+
+/// Compute the exact determinant of the square \p io_matrix of integral values, via fraction-free elimination.
+///
+/// \p io_matrix is the working matrix, reduced to upper triangular form throughout elimination.
+///
+/// \return \p false if the determinant, or an intermediate minor, overflows the value type.
+template < typename MatrixT >
+inline bool _MatrixBareissDeterminant( MatrixT& io_matrix, typename MatrixT::ValueType& o_determinant )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    using ValueT = typename MatrixT::ValueType;
+
+    int rank         = 0;
+    int rowExchanges = 0;
+    if ( !_MatrixBareiss( io_matrix, rank, rowExchanges ) )
+    {
+        return false;
+    }
+
+    // The last pivot is the determinant, up to the sign of the row exchanges.
+    const ValueT lastPivot = io_matrix( MatrixT::RowCount() - 1, MatrixT::RowCount() - 1 );
+    if ( rank < MatrixT::RowCount() )
+    {
+        o_determinant = 0;
+    }
+    else if ( rowExchanges % 2 == 0 )
+    {
+        o_determinant = lastPivot;
+    }
+    else if ( lastPivot == std::numeric_limits< ValueT >::min() )
+    {
+        return false;
+    }
+    else
+    {
+        o_determinant = -lastPivot;
+    }
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,374 @@
+#pragma once
+
+/// \file matrixBlockedLU.h
+///
+/// Blocked right-looking LU decomposition implementation details.
+///
+/// The columns are factored in panels of \p BLOCK_SIZE.  Each step partitions the remaining matrix as
+/// \f[
+/// \begin{bmatrix} A_{11} & A_{12} \\ A_{21} & A_{22} \end{bmatrix}
+/// \f]
+/// where \f$[A_{11}; A_{21}]\f$ is the panel.  The panel is factored one pivot at a time, then
+/// \f$U_{12} = L_{11}^{-1}A_{12}\f$, and the trailing matrix receives a single rank-\p BLOCK_SIZE update,
+/// \f$A_{22} \leftarrow A_{22} - L_{21}U_{12}\f$.  The trailing update holds the bulk of the operations, and runs
+/// as a cache-blocked matrix multiplication rather than one memory-bound row operation per pivot.
+
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixEntryArray.h>
+#include <linear/base/matrixTriangularSolve.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+LINEAR_NS_OPEN
+
+/// The default number of columns per panel of the blocked LU decomposition.
+constexpr size_t _LU_BLOCK_SIZE = 32;
+
+/// The number of columns of the output processed at once by \ref _MultiplySubtract, sized such that the
+/// corresponding tile of the right-hand side stays in the L1 cache across the output rows.
+constexpr int _MULTIPLY_COLUMN_TILE_SIZE = 64;
+
+/// Compute \f$C \leftarrow C - AB\f$, where \f$C\f$ is \p i_rowCount x \p i_columnCount, and the inner dimension is
+/// \p i_depth.
+///
+/// The matrices are addressed through a pointer to their first entry and the stride between their rows, so that
+/// sub-matrices are operated on in place.  The innermost loop runs over contiguous entries of the rows of \f$B\f$
+/// and \f$C\f$, and is vectorized by the compiler.  Four rows of \f$B\f$ are accumulated per pass over a row of
+/// \f$C\f$, to reduce the loads and stores of \f$C\f$.
+template < typename ValueT >
+inline void _MultiplySubtract( int           i_rowCount,
+                               int           i_columnCount,
+                               int           i_depth,
+                               const ValueT* i_lhs,
+                               int           i_lhsStride,
+                               const ValueT* i_rhs,
+                               int           i_rhsStride,
+                               ValueT*       io_output,
+                               int           i_outputStride )
+{
+    for ( int columnBegin = 0; columnBegin < i_columnCount; columnBegin += _MULTIPLY_COLUMN_TILE_SIZE )
+    {
+        const int columnEnd = std::min( columnBegin + _MULTIPLY_COLUMN_TILE_SIZE, i_columnCount );
+        for ( int rowIndex = 0; rowIndex < i_rowCount; ++rowIndex )
+        {
+            const ValueT* lhsRow    = i_lhs + rowIndex * i_lhsStride;
+            ValueT*       outputRow = io_output + rowIndex * i_outputStride;
+
+            int depthIndex = 0;
+            for ( ; depthIndex + 4 <= i_depth; depthIndex += 4 )
+            {
+                const ValueT  factor0 = lhsRow[ depthIndex ];
+                const ValueT  factor1 = lhsRow[ depthIndex + 1 ];
+                const ValueT  factor2 = lhsRow[ depthIndex + 2 ];
+                const ValueT  factor3 = lhsRow[ depthIndex + 3 ];
+                const ValueT* rhsRow0 = i_rhs + depthIndex * i_rhsStride;
+                const ValueT* rhsRow1 = rhsRow0 + i_rhsStride;
+                const ValueT* rhsRow2 = rhsRow1 + i_rhsStride;
+                const ValueT* rhsRow3 = rhsRow2 + i_rhsStride;
+                for ( int columnIndex = columnBegin; columnIndex < columnEnd; ++columnIndex )
+                {
+                    outputRow[ columnIndex ] -= factor0 * rhsRow0[ columnIndex ] + factor1 * rhsRow1[ columnIndex ] +
+                                                factor2 * rhsRow2[ columnIndex ] + factor3 * rhsRow3[ columnIndex ];
+                }
+            }
+
+            for ( ; depthIndex < i_depth; ++depthIndex )
+            {
+                _EliminateRow( i_rhs + depthIndex * i_rhsStride,
+                               lhsRow[ depthIndex ],
+                               columnBegin,
+                               columnEnd,
+                               outputRow );
+            }
+        }
+    }
+}
+
+/// Factor the panel of columns [\p i_blockBegin, \p i_blockEnd) of \p io_matrix, from row \p i_blockBegin down,
+/// one pivot at a time.
+///
+/// Rows are exchanged as selected by \p PivotT, but only within the columns of the panel.  The row exchanged with
+/// each pivot row is recorded in \p o_pivotRows, to be applied to the other columns by \ref _ApplyRowExchanges.
+///
+/// \return \p true if every pivot of the panel is non-zero.
+template < typename PivotT, typename MatrixT, typename PivotRowsT >
+inline bool _FactorLUPanel( int         i_blockBegin,
+                            int         i_blockEnd,
+                            MatrixT&    io_matrix,
+                            PivotRowsT& o_pivotRows,
+                            int&        io_rowExchanges )
+{
+    using ValueT       = typename MatrixT::ValueType;
+    constexpr int SIZE = MatrixT::RowCount();
+
+    bool isNonSingular = true;
+    for ( int pivotIndex = i_blockBegin; pivotIndex < i_blockEnd; ++pivotIndex )
+    {
+        o_pivotRows[ pivotIndex ] = pivotIndex;
+
+        if constexpr ( _ExchangesRows< PivotT >() )
+        {
+            int exchangedRow = PivotT::FindPivotRow( pivotIndex, pivotIndex, io_matrix );
+            if ( exchangedRow == -1 )
+            {
+                // This column has no usable pivot, thus the matrix is singular.  The column below the diagonal is
+                // entirely zero, thus there is nothing to eliminate.
+                isNonSingular = false;
+                continue;
+            }
+            else if ( exchangedRow != pivotIndex )
+            {
+                std::swap_ranges( &io_matrix( pivotIndex, i_blockBegin ),
+                                  &io_matrix( pivotIndex, 0 ) + i_blockEnd,
+                                  &io_matrix( exchangedRow, i_blockBegin ) );
+                o_pivotRows[ pivotIndex ] = exchangedRow;
+                io_rowExchanges++;
+            }
+        }
+        else if ( io_matrix( pivotIndex, pivotIndex ) == 0 )
+        {
+            // The matrix is singular, or requires a row exchange.
+            isNonSingular = false;
+            continue;
+        }
+
+        // Store the elimination factors in place of the eliminated co-efficients.
+        const ValueT  pivotValueReciprocal = 1.0 / io_matrix( pivotIndex, pivotIndex );
+        const ValueT* pivotRow             = &io_matrix( pivotIndex, 0 );
+        for ( int rowIndex = pivotIndex + 1; rowIndex < SIZE; ++rowIndex )
+        {
+            const ValueT targetValue = io_matrix( rowIndex, pivotIndex );
+            if ( targetValue != 0 )
+            {
+                const ValueT eliminationFactor    = targetValue * pivotValueReciprocal;
+                io_matrix( rowIndex, pivotIndex ) = eliminationFactor;
+                _EliminateRow( pivotRow, eliminationFactor, pivotIndex + 1, i_blockEnd, &io_matrix( rowIndex, 0 ) );
+            }
+        }
+    }
+
+    return isNonSingular;
+}
+
+/// Apply the row exchanges recorded in \p i_pivotRows for the pivots [\p i_pivotBegin, \p i_pivotEnd), in order,
+/// to the columns [\p i_columnBegin, \p i_columnEnd) of \p io_matrix.
+template < typename MatrixT, typename PivotRowsT >
+inline void _ApplyRowExchanges( int               i_pivotBegin,
+                                int               i_pivotEnd,
+                                const PivotRowsT& i_pivotRows,
+                                int               i_columnBegin,
+                                int               i_columnEnd,
+                                MatrixT&          io_matrix )
+{
+    if ( i_columnBegin == i_columnEnd )
+    {
+        return;
+    }
+
+    for ( int pivotIndex = i_pivotBegin; pivotIndex < i_pivotEnd; ++pivotIndex )
+    {
+        if ( i_pivotRows[ pivotIndex ] != pivotIndex )
+        {
+            std::swap_ranges( &io_matrix( pivotIndex, i_columnBegin ),
+                              &io_matrix( pivotIndex, 0 ) + i_columnEnd,
+                              &io_matrix( i_pivotRows[ pivotIndex ], i_columnBegin ) );
+        }
+    }
+}
+
+/// Compute \f$U_{12} = L_{11}^{-1}A_{12}\f$ in-place by forward substitution, where \f$L_{11}\f$ is the unit lower
+/// triangular factor of the panel [\p i_blockBegin, \p i_blockEnd), and \f$A_{12}\f$ spans the same rows and the
+/// columns [\p i_columnBegin, \p i_columnEnd).
+template < typename MatrixT >
+inline void _SolveLUBlockRow( int i_blockBegin, int i_blockEnd, int i_columnBegin, int i_columnEnd, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    for ( int rowIndex = i_blockBegin + 1; rowIndex < i_blockEnd; ++rowIndex )
+    {
+        for ( int pivotIndex = i_blockBegin; pivotIndex < rowIndex; ++pivotIndex )
+        {
+            const ValueT eliminationFactor = io_matrix( rowIndex, pivotIndex );
+            _EliminateRow( &io_matrix( pivotIndex, 0 ),
+                           eliminationFactor,
+                           i_columnBegin,
+                           i_columnEnd,
+                           &io_matrix( rowIndex, 0 ) );
+        }
+    }
+}
+
+/// Compute the LU decomposition of \p io_matrix in-place, in panels of \p BLOCK_SIZE columns.
+///
+/// Upon completion, the strictly lower triangular part of \p io_matrix holds \f$L\f$ (with an implicit unit
+/// diagonal), and the upper triangular part holds \f$U\f$.  Rows are exchanged as selected by \p PivotT, and the
+/// row exchanged with each pivot row is recorded in \p o_pivotRows, in order of elimination.
+///
+/// \param io_matrix the matrix to factor in-place.
+/// \param o_pivotRows the row exchanged with each pivot row.
+/// \param o_rowExchanges the number of row exchanges performed.
+///
+/// \return \p true if every pivot is non-zero, thus the matrix is non-singular.
+template < size_t BLOCK_SIZE, typename PivotT, typename MatrixT, typename PivotRowsT >
+inline bool _MatrixBlockedLU( MatrixT& io_matrix, PivotRowsT& o_pivotRows, int& o_rowExchanges )
+{
+    static_assert( BLOCK_SIZE > 0 );
+    constexpr int SIZE = MatrixT::RowCount();
+
+    o_rowExchanges     = 0;
+    bool isNonSingular = true;
+    for ( int blockBegin = 0; blockBegin < SIZE; blockBegin += BLOCK_SIZE )
+    {
+        const int blockEnd = std::min< int >( blockBegin + BLOCK_SIZE, SIZE );
+
+        // Factor the panel, then apply its row exchanges to the factors of L computed so far, and the trailing
+        // columns.
+        isNonSingular &= _FactorLUPanel< PivotT >( blockBegin, blockEnd, io_matrix, o_pivotRows, o_rowExchanges );
+        _ApplyRowExchanges( blockBegin, blockEnd, o_pivotRows, 0, blockBegin, io_matrix );
+        _ApplyRowExchanges( blockBegin, blockEnd, o_pivotRows, blockEnd, SIZE, io_matrix );
+
+        if ( blockEnd == SIZE )
+        {
+            break;
+        }
+
+        // U12 = L11^-1 * A12.
+        _SolveLUBlockRow( blockBegin, blockEnd, blockEnd, SIZE, io_matrix );
+
+        // A22 -= L21 * U12.
+        _MultiplySubtract( SIZE - blockEnd /* rowCount */,
+                           SIZE - blockEnd /* columnCount */,
+                           blockEnd - blockBegin /* depth */,
+                           &io_matrix( blockEnd, blockBegin ),
+                           SIZE,
+                           &io_matrix( blockBegin, blockEnd ),
+                           SIZE,
+                           &io_matrix( blockEnd, blockEnd ),
+                           SIZE );
+    }
+
+    return isNonSingular;
+}
+
+/// Solve \f$AX = B\f$ in-place, where \p i_lu holds the packed factors of \f$A\f$ computed by
+/// \ref _MatrixBlockedLU, and \p i_pivotRows its recorded row exchanges.
+///
+/// \p io_solution is initially \f$B\f$, and assumes the solution \f$X\f$.
+template < typename MatrixT, typename PivotRowsT, typename SolutionT >
+inline void _LUSolve( const MatrixT& i_lu, const PivotRowsT& i_pivotRows, SolutionT& io_solution )
+{
+    // Apply the row exchanges: PB.
+    for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
+    {
+        if ( i_pivotRows[ pivotIndex ] != pivotIndex )
+        {
+            std::swap_ranges( &io_solution( pivotIndex, 0 ),
+                              &io_solution( pivotIndex, 0 ) + SolutionT::ColumnCount(),
+                              &io_solution( i_pivotRows[ pivotIndex ], 0 ) );
+        }
+    }
+
+    // Forward substitution, replaying the elimination: L^-1PB.
+    _LowerTriangularSolve< /* UNIT_DIAGONAL */ true >( i_lu, io_solution );
+
+    // Back substitution: U^-1L^-1PB.
+    _UpperTriangularSolve( i_lu, io_solution );
+}
+
+/// Compute the inverse of \f$A\f$ in-place, where \p io_matrix initially holds the packed factors of \f$A\f$
+/// computed by \ref _MatrixBlockedLU, and \p i_pivotRows its recorded row exchanges.
+///
+/// As in LAPACK's \p getri, \f$U\f$ is inverted in-place, then \f$A^{-1}L = U^{-1}\f$ is solved for \f$A^{-1}\f$
+/// one column at a time from the last, and finally the row exchanges are undone as column exchanges.  Only a
+/// single row of \f$U\f$ or column of \f$L\f$ is held aside at a time, thus no scratch matrix is required.
+///
+/// \pre Every pivot of the factors must be non-zero.
+template < typename MatrixT, typename PivotRowsT >
+inline void _LUInverse( MatrixT& io_matrix, const PivotRowsT& i_pivotRows )
+{
+    using ValueT       = typename MatrixT::ValueType;
+    constexpr int SIZE = MatrixT::RowCount();
+
+    // U^-1, one row at a time from the last, as combinations of the trailing rows which already hold their
+    // inverse, setting aside the row of U it replaces.
+    std::array< ValueT, SIZE > factors;
+    for ( int rowIndex = SIZE - 1; rowIndex >= 0; --rowIndex )
+    {
+        ValueT* row = &io_matrix( rowIndex, 0 );
+        for ( int columnIndex = rowIndex + 1; columnIndex < SIZE; ++columnIndex )
+        {
+            factors[ columnIndex ] = row[ columnIndex ];
+            row[ columnIndex ]     = 0;
+        }
+
+        for ( int index = rowIndex + 1; index < SIZE; ++index )
+        {
+            _EliminateRow( &io_matrix( index, 0 ), factors[ index ], index, SIZE, row );
+        }
+
+        const ValueT diagonalReciprocal = ValueT( 1 ) / row[ rowIndex ];
+        row[ rowIndex ]                 = diagonalReciprocal;
+        for ( int columnIndex = rowIndex + 1; columnIndex < SIZE; ++columnIndex )
+        {
+            row[ columnIndex ] *= diagonalReciprocal;
+        }
+    }
+
+    // A^-1 = U^-1 L^-1, from the last column, setting aside the column of L it replaces.
+    for ( int columnIndex = SIZE - 2; columnIndex >= 0; --columnIndex )
+    {
+        for ( int rowIndex = columnIndex + 1; rowIndex < SIZE; ++rowIndex )
+        {
+            factors[ rowIndex ]            = io_matrix( rowIndex, columnIndex );
+            io_matrix( rowIndex, columnIndex ) = 0;
+        }
+
+        const int trailingCount = SIZE - columnIndex - 1;
+        for ( int rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+        {
+            io_matrix( rowIndex, columnIndex ) -= _DotProduct( &io_matrix( rowIndex, columnIndex + 1 ),
+                                                               &factors[ columnIndex + 1 ],
+                                                               trailingCount );
+        }
+    }
+
+    // A^-1 = U^-1 L^-1 P: undo the row exchanges as column exchanges, in reverse order.
+    for ( int pivotIndex = SIZE - 1; pivotIndex >= 0; --pivotIndex )
+    {
+        const int exchangedRow = i_pivotRows[ pivotIndex ];
+        if ( exchangedRow != pivotIndex )
+        {
+            for ( int rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+            {
+                std::swap( io_matrix( rowIndex, pivotIndex ), io_matrix( rowIndex, exchangedRow ) );
+            }
+        }
+    }
+}
+
+/// Compute the inverse of \p i_matrix in-place within \p o_inverse, through the blocked LU decomposition.
+///
+/// \return \p true if \p i_matrix is non-singular.
+template < typename PivotT, typename MatrixT >
+inline bool _MatrixInverseBlockedLU( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    constexpr int                          N = MatrixT::RowCount();
+    std::array< CompactIndexType< N >, N > pivotRows;
+    int                                    rowExchanges = 0;
+
+    o_inverse = i_matrix;
+    if ( !_MatrixBlockedLU< _LU_BLOCK_SIZE, PivotT >( o_inverse, pivotRows, rowExchanges ) )
+    {
+        return false;
+    }
+
+    _LUInverse( o_inverse, pivotRows );
+    return true;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,173 @@
+#pragma once
+
+/// \file matrixCholesky.h
+///
+/// Cholesky factorization implementation details.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixTriangularSolve.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// Factor the diagonal block [\p i_blockBegin, \p i_blockEnd) of the symmetric matrix \p io_matrix into \f$LL^T\f$
+/// in-place.
+///
+/// The contributions of the columns before \p i_blockBegin must already have been subtracted from the block, via
+/// \ref _UpdateCholeskyBlock.  Only the lower triangular part of the block is read, which is replaced by \f$L\f$.
+///
+/// \return \p true if the block is positive definite.
+template < typename MatrixT >
+inline bool _FactorCholeskyBlock( int i_blockBegin, int i_blockEnd, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    for ( int columnIndex = i_blockBegin; columnIndex < i_blockEnd; ++columnIndex )
+    {
+        // Row of L being completed, which shares its computed prefix with the rows below.
+        const ValueT* factorRow   = &io_matrix( columnIndex, i_blockBegin );
+        const int     prefixCount = columnIndex - i_blockBegin;
+
+        // Diagonal entry.
+        ValueT diagonal = io_matrix( columnIndex, columnIndex );
+        diagonal -= _DotProduct( factorRow, factorRow, prefixCount );
+        if ( !( diagonal > 0 ) )
+        {
+            return false;
+        }
+
+        diagonal                              = std::sqrt( diagonal );
+        io_matrix( columnIndex, columnIndex ) = diagonal;
+        const ValueT diagonalReciprocal       = 1.0 / diagonal;
+
+        // Entries below the diagonal.
+        for ( int rowIndex = columnIndex + 1; rowIndex < i_blockEnd; ++rowIndex )
+        {
+            ValueT& entry = io_matrix( rowIndex, columnIndex );
+            entry -= _DotProduct( &io_matrix( rowIndex, i_blockBegin ), factorRow, prefixCount );
+            entry *= diagonalReciprocal;
+        }
+    }
+
+    return true;
+}
+
+/// Compute the block \f$L_{ik} = A_{ik}L_{kk}^{-T}\f$ in-place, spanning the rows [\p i_rowBegin, \p i_rowEnd) and the
+/// columns of the factored diagonal block [\p i_blockBegin, \p i_blockEnd).
+///
+/// Each row is solved independently, over contiguous entries.
+template < typename MatrixT >
+inline void _SolveCholeskyBlock( int i_blockBegin, int i_blockEnd, int i_rowBegin, int i_rowEnd, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    for ( int rowIndex = i_rowBegin; rowIndex < i_rowEnd; ++rowIndex )
+    {
+        ValueT* row = &io_matrix( rowIndex, i_blockBegin );
+        for ( int columnIndex = i_blockBegin; columnIndex < i_blockEnd; ++columnIndex )
+        {
+            const int prefixCount = columnIndex - i_blockBegin;
+            row[ prefixCount ] -= _DotProduct( row, &io_matrix( columnIndex, i_blockBegin ), prefixCount );
+            row[ prefixCount ] /= io_matrix( columnIndex, columnIndex );
+        }
+    }
+}
+
+/// Subtract the contributions of the factored columns [\p i_depthBegin, \p i_depthEnd) from the block spanning the
+/// rows [\p i_rowBegin, \p i_rowEnd) and the columns [\p i_columnBegin, \p i_columnEnd): \f$A_{ij} \leftarrow
+/// A_{ij} - L_{ik}L_{jk}^T\f$.
+///
+/// Only entries within the lower triangular part are updated.
+template < typename MatrixT >
+inline void _UpdateCholeskyBlock( int      i_depthBegin,
+                                  int      i_depthEnd,
+                                  int      i_rowBegin,
+                                  int      i_rowEnd,
+                                  int      i_columnBegin,
+                                  int      i_columnEnd,
+                                  MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    const int depth = i_depthEnd - i_depthBegin;
+    for ( int rowIndex = i_rowBegin; rowIndex < i_rowEnd; ++rowIndex )
+    {
+        const ValueT* lhsRow    = &io_matrix( rowIndex, i_depthBegin );
+        const int     columnEnd = std::min( i_columnEnd, rowIndex + 1 );
+        for ( int columnIndex = i_columnBegin; columnIndex < columnEnd; ++columnIndex )
+        {
+            io_matrix( rowIndex, columnIndex ) -= _DotProduct( lhsRow, &io_matrix( columnIndex, i_depthBegin ), depth );
+        }
+    }
+}
+
+/// Factor the symmetric matrix \p io_matrix into \f$LL^T\f$ in-place, where \f$L\f$ is lower triangular.
+///
+/// Only the lower triangular part of \p io_matrix is read, which is replaced by \f$L\f$.  The strictly upper
+/// triangular part is left un-modified.
+///
+/// \return \p true if the matrix is positive definite.  \p false otherwise, in which case the value of
+/// \p io_matrix is un-defined.
+template < typename MatrixT >
+inline bool _MatrixCholesky( MatrixT& io_matrix )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    return _FactorCholeskyBlock( 0, MatrixT::RowCount(), io_matrix );
+}
+
+/// Factor the symmetric matrix \p io_matrix into \f$LDL^T\f$ in-place, where \f$L\f$ is unit lower triangular
+/// and \f$D\f$ is diagonal.
+///
+/// Only the lower triangular part of \p io_matrix is read.  The strictly lower triangular part is replaced by
+/// \f$L\f$ and the diagonal by \f$D\f$.  The strictly upper triangular part is left un-modified.
+///
+/// \return \p true if all the entries of \f$D\f$ are non-zero.  \p false otherwise, in which case the value of
+/// \p io_matrix is un-defined.
+template < typename MatrixT >
+inline bool _MatrixLDLT( MatrixT& io_matrix )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    using ValueT = typename MatrixT::ValueType;
+
+    // Entries of the current row of L, scaled by the diagonal: L(j, k) * D(k).
+    std::array< ValueT, MatrixT::ColumnCount() > scaledRow;
+
+    for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+    {
+        const ValueT* factorRow = &io_matrix( columnIndex, 0 );
+        for ( int entryIndex = 0; entryIndex < columnIndex; ++entryIndex )
+        {
+            scaledRow[ entryIndex ] = factorRow[ entryIndex ] * io_matrix( entryIndex, entryIndex );
+        }
+
+        // Diagonal entry.
+        ValueT diagonal = io_matrix( columnIndex, columnIndex );
+        diagonal -= _DotProduct( factorRow, scaledRow.data(), columnIndex );
+        if ( diagonal == 0 )
+        {
+            return false;
+        }
+
+        io_matrix( columnIndex, columnIndex ) = diagonal;
+        const ValueT diagonalReciprocal       = 1.0 / diagonal;
+
+        // Entries below the diagonal.
+        for ( int rowIndex = columnIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            ValueT& entry = io_matrix( rowIndex, columnIndex );
+            entry -= _DotProduct( &io_matrix( rowIndex, 0 ), scaledRow.data(), columnIndex );
+            entry *= diagonalReciprocal;
+        }
+    }
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
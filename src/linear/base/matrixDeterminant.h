@@ -0,0 +1,135 @@
+#pragma once
+
+/// \file matrixDeterminant.h
+///
+/// Matrix determinant implementation details.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/intRange.h>
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+LINEAR_NS_OPEN
+
+/// Compute the determinant of a matrix via the product of pivots, using caller-provided scratch memory.
+///
+/// \p io_matrix is the working matrix, which is initially the matrix to compute the determinant of, and is
+/// reduced to upper triangular form throughout elimination.  \p o_eliminationFactors is the scratch record of
+/// a single elimination step.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT, typename MatrixT, typename EliminationRecordT >
+inline typename MatrixT::ValueType _MatrixDeterminant( MatrixT& io_matrix, EliminationRecordT& o_eliminationFactors )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    // Count the number of row exchanges.
+    int numRowExchanges = 0;
+
+    for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount() - 1; ++pivotIndex )
+    {
+        // Select a pivot, exchanging rows if required.
+        if constexpr ( _ExchangesRows< PivotT >() )
+        {
+            int exchangedRow = _FindAndPerformRowExchange< PivotT >( pivotIndex, pivotIndex, io_matrix );
+            if ( exchangedRow == -1 )
+            {
+                // Matrix is singular, then the determinant is 0.
+                return 0;
+            }
+            else if ( exchangedRow != pivotIndex )
+            {
+                numRowExchanges++;
+            }
+        }
+        else if ( io_matrix( pivotIndex, pivotIndex ) == 0 )
+        {
+            return 0;
+        }
+
+        // Perform elimination.
+        _RecordElimination( pivotIndex,
+                            pivotIndex,
+                            IntRange( pivotIndex + 1, MatrixT::RowCount() ) /* rowRange */,
+                            pivotIndex /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
+
+        // Reset the cache for the next iteration.
+        o_eliminationFactors.Reset();
+    }
+
+    // Compute product of pivots.
+    typename MatrixT::ValueType determinant = io_matrix( 0, 0 );
+    for ( int pivotIndex = 1; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
+    {
+        determinant *= io_matrix( pivotIndex, pivotIndex );
+    }
+
+    // Odd # of row exchanges imparts a -1 factor.
+    if ( numRowExchanges % 2 == 0 )
+    {
+        return determinant;
+    }
+    else
+    {
+        return -determinant;
+    }
+}
+
+/// Check if the matrix type \p MatrixT has a closed-form determinant kernel.
+template < typename MatrixT >
+constexpr inline bool _HasClosedFormDeterminant()
+{
+    return MatrixT::RowCount() == MatrixT::ColumnCount() && MatrixT::RowCount() <= 4;
+}
+
+/// Compute the determinant of a 1x1, 2x2, 3x3 or 4x4 matrix in closed-form, through cofactor expansion.
+///
+/// This is a fixed sequence of multiply-adds, which can be evaluated at compile-time.
+template < typename MatrixT >
+constexpr inline typename MatrixT::ValueType _MatrixDeterminantClosedForm( const MatrixT& i_matrix )
+{
+    static_assert( _HasClosedFormDeterminant< MatrixT >() );
+    using ValueT = typename MatrixT::ValueType;
+
+    if constexpr ( MatrixT::RowCount() == 1 )
+    {
+        return i_matrix( 0, 0 );
+    }
+    else if constexpr ( MatrixT::RowCount() == 2 )
+    {
+        return i_matrix( 0, 0 ) * i_matrix( 1, 1 ) - i_matrix( 0, 1 ) * i_matrix( 1, 0 );
+    }
+    else if constexpr ( MatrixT::RowCount() == 3 )
+    {
+        // Expansion along the first row.
+        return i_matrix( 0, 0 ) * ( i_matrix( 1, 1 ) * i_matrix( 2, 2 ) - i_matrix( 1, 2 ) * i_matrix( 2, 1 ) ) +
+               i_matrix( 0, 1 ) * ( i_matrix( 1, 2 ) * i_matrix( 2, 0 ) - i_matrix( 1, 0 ) * i_matrix( 2, 2 ) ) +
+               i_matrix( 0, 2 ) * ( i_matrix( 1, 0 ) * i_matrix( 2, 1 ) - i_matrix( 1, 1 ) * i_matrix( 2, 0 ) );
+    }
+    else
+    {
+        // Laplace expansion, over the 2x2 minors of the top two rows and bottom two rows.
+        const ValueT s0 = i_matrix( 0, 0 ) * i_matrix( 1, 1 ) - i_matrix( 1, 0 ) * i_matrix( 0, 1 );
+        const ValueT s1 = i_matrix( 0, 0 ) * i_matrix( 1, 2 ) - i_matrix( 1, 0 ) * i_matrix( 0, 2 );
+        const ValueT s2 = i_matrix( 0, 0 ) * i_matrix( 1, 3 ) - i_matrix( 1, 0 ) * i_matrix( 0, 3 );
+        const ValueT s3 = i_matrix( 0, 1 ) * i_matrix( 1, 2 ) - i_matrix( 1, 1 ) * i_matrix( 0, 2 );
+        const ValueT s4 = i_matrix( 0, 1 ) * i_matrix( 1, 3 ) - i_matrix( 1, 1 ) * i_matrix( 0, 3 );
+        const ValueT s5 = i_matrix( 0, 2 ) * i_matrix( 1, 3 ) - i_matrix( 1, 2 ) * i_matrix( 0, 3 );
+
+        const ValueT c5 = i_matrix( 2, 2 ) * i_matrix( 3, 3 ) - i_matrix( 3, 2 ) * i_matrix( 2, 3 );
+        const ValueT c4 = i_matrix( 2, 1 ) * i_matrix( 3, 3 ) - i_matrix( 3, 1 ) * i_matrix( 2, 3 );
+        const ValueT c3 = i_matrix( 2, 1 ) * i_matrix( 3, 2 ) - i_matrix( 3, 1 ) * i_matrix( 2, 2 );
+        const ValueT c2 = i_matrix( 2, 0 ) * i_matrix( 3, 3 ) - i_matrix( 3, 0 ) * i_matrix( 2, 3 );
+        const ValueT c1 = i_matrix( 2, 0 ) * i_matrix( 3, 2 ) - i_matrix( 3, 0 ) * i_matrix( 2, 2 );
+        const ValueT c0 = i_matrix( 2, 0 ) * i_matrix( 3, 1 ) - i_matrix( 3, 0 ) * i_matrix( 2, 1 );
+
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+}
+
+LINEAR_NS_CLOSE
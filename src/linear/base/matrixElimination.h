@@ -10,106 +10,139 @@
 
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/pivoting.h>
 #include <linear/row.h>
 
 LINEAR_NS_OPEN
 
-/// Find a row \em below row \p i_pivotRowIndex in matrix \p o_matrix such that its co-efficient
-/// (at \p i_pivotColIndex) is not 0, then exchange it with the pivot row.
+/// Select the pivot row for column \p i_pivotColIndex, at or below row \p i_pivotRowIndex in matrix \p o_matrix,
+/// using the pivoting policy \p PivotT, then exchange it with the pivot row.
 ///
-/// \return a positive integer if a viable row is found.  Otherwise, \p -1.
-template < typename MatrixT >
+/// \return the index of the row exchanged into the pivot position (\p i_pivotRowIndex if no exchange was
+/// required), or \p -1 if there is no usable pivot.
+template < typename PivotT, typename MatrixT >
 inline int _FindAndPerformRowExchange( int i_pivotRowIndex, int i_pivotColIndex, MatrixT& o_matrix )
 {
-    // Double check that value at the current pivot is 0 (which is why a row-exchange is required in the first place!)
-    LINEAR_ASSERT( o_matrix( i_pivotRowIndex, i_pivotColIndex ) == 0 );
+    int pivotRowIndex = PivotT::FindPivotRow( i_pivotRowIndex, i_pivotColIndex, o_matrix );
+    if ( pivotRowIndex != -1 && pivotRowIndex != i_pivotRowIndex )
+    {
+        RowExchange( pivotRowIndex, i_pivotRowIndex, o_matrix );
+    }
+
+    return pivotRowIndex;
+}
 
-    for ( int rowIndex = i_pivotRowIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+/// Subtract \p i_factor multiples of the pivot row from the target row, across the columns in the range
+/// [\p i_columnBegin, \p i_columnEnd).
+///
+/// Both rows are addressed through pointers to their first entry, so that the inner loop runs over contiguous
+/// memory and can be vectorized by the compiler.
+template < typename ValueT >
+inline void _EliminateRow( const ValueT* i_pivotRow,
+                           const ValueT& i_factor,
+                           int           i_columnBegin,
+                           int           i_columnEnd,
+                           ValueT*       o_targetRow )
+{
+    for ( int columnIndex = i_columnBegin; columnIndex < i_columnEnd; ++columnIndex )
     {
-        if ( o_matrix( rowIndex, i_pivotColIndex ) != 0 )
-        {
-            RowExchange( rowIndex, i_pivotRowIndex, o_matrix );
-            return rowIndex;
-        }
+        o_targetRow[ columnIndex ] -= i_factor * i_pivotRow[ columnIndex ];
+    }
+}
+
+/// Compute the dot product of the first \p i_count entries of rows \p i_rowA and \p i_rowB.
+///
+/// Both rows are addressed through pointers to their first entry, so that the loop runs over contiguous memory.
+template < typename ValueT >
+inline ValueT _DotProduct( const ValueT* i_rowA, const ValueT* i_rowB, int i_count )
+{
+    ValueT dotProduct = 0;
+    for ( int columnIndex = 0; columnIndex < i_count; ++columnIndex )
+    {
+        dotProduct += i_rowA[ columnIndex ] * i_rowB[ columnIndex ];
     }
+    return dotProduct;
+}
 
-    return -1;
+/// Apply a plane rotation to the pair of rows \p io_rowP and \p io_rowQ, of \p i_count entries each.
+template < typename ValueT >
+inline void _RotateRows( const ValueT& i_cos, const ValueT& i_sin, int i_count, ValueT* io_rowP, ValueT* io_rowQ )
+{
+    for ( int index = 0; index < i_count; ++index )
+    {
+        const ValueT p   = io_rowP[ index ];
+        const ValueT q   = io_rowQ[ index ];
+        io_rowP[ index ] = i_cos * p - i_sin * q;
+        io_rowQ[ index ] = i_sin * p + i_cos * q;
+    }
 }
+
 /// Performs an elimination step by subtracting the pivot row from all the rows below with a non-zero co-efficient,
-/// to \em zero them out.
+/// to \em zero them out.  Only the columns in the range [\p i_columnBegin, \p i_columnEnd) are updated.
 ///
 /// \p o_eliminationFactors is populated with the eliminated row indices and the corresponding factors.
 ///
 /// Allowing the recording of the elimination factors at the respective rows allow the same operations to be efficiently
 /// replayed and performed on another matrix.
-template < typename MatrixT >
-inline void
-_RecordElimination( int                                                                   i_pivotRowIndex,
-                    int                                                                   i_pivotColIndex,
-                    const IntRange&                                                       i_rowRange,
-                    const IntRange&                                                       i_columnRange,
-                    MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType >& o_eliminationFactors,
-                    MatrixT&                                                              o_matrix )
+template < typename MatrixT, typename EliminationRecordT >
+inline void _RecordElimination( int                 i_pivotRowIndex,
+                                int                 i_pivotColIndex,
+                                const IntRange&     i_rowRange,
+                                int                 i_columnBegin,
+                                int                 i_columnEnd,
+                                EliminationRecordT& o_eliminationFactors,
+                                MatrixT&            o_matrix )
 {
+    using ValueT = typename MatrixT::ValueType;
+
     // Double check pivot.
     LINEAR_ASSERT( o_matrix( i_pivotRowIndex, i_pivotColIndex ) != 0 );
 
     // Store the reciprocal of the pivot co-efficient for usage throughout this elimination step.
-    const typename MatrixT::ValueType pivotValueReciprocal = 1.0 / o_matrix( i_pivotRowIndex, i_pivotColIndex );
+    const ValueT pivotValueReciprocal = 1.0 / o_matrix( i_pivotRowIndex, i_pivotColIndex );
 
-    // Cache the pivot row.
-    Matrix< 1, MatrixT::ColumnCount() > pivotRow = o_matrix.GetRow( i_pivotRowIndex );
+    // The pivot row is not modified throughout this step, so it is read in-place.
+    const ValueT* pivotRow = &o_matrix( i_pivotRowIndex, 0 );
 
     // For each row below the pivot, try to eliminate any non-zero co-efficients.
     for ( int rowIndex : i_rowRange )
     {
-        typename MatrixT::ValueType targetValue = o_matrix( rowIndex, i_pivotColIndex );
+        ValueT targetValue = o_matrix( rowIndex, i_pivotColIndex );
         if ( targetValue != 0 )
         {
             // Compute the elimination factor.
-            typename MatrixT::ValueType eliminationFactor = targetValue * pivotValueReciprocal;
+            ValueT eliminationFactor = targetValue * pivotValueReciprocal;
 
             // Eliminate a co-efficient.
-            Matrix< 1, MatrixT::ColumnCount() > eliminationRow = pivotRow * eliminationFactor;
-            for ( int columnIndex : i_columnRange )
-            {
-                o_matrix( rowIndex, columnIndex ) -= eliminationRow( 0, columnIndex );
-            }
+            _EliminateRow( pivotRow, eliminationFactor, i_columnBegin, i_columnEnd, &o_matrix( rowIndex, 0 ) );
 
             // Cache the row index and factor for replay-ability on another matrix.
-            o_eliminationFactors.Append( rowIndex, i_pivotColIndex, eliminationFactor );
+            o_eliminationFactors.Append( rowIndex, eliminationFactor );
         }
     }
 }
 
 /// Performs an elimination step by subtracting the pivot row from all the rows below, to \em zero out
 /// the co-efficients under the pivot, using by replaying the cache entries from \p i_eliminationFactors.
-template < typename MatrixT >
-inline void
-_ReplayElimination( int                                                                         i_pivotRowIndex,
-                    int                                                                         i_pivotColIndex,
-                    const IntRange&                                                             i_columnRange,
-                    const MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType >& i_eliminationFactors,
-                    MatrixT&                                                                    o_matrix )
+/// Only the columns in the range [\p i_columnBegin, \p i_columnEnd) are updated.
+template < typename EliminationRecordT, typename MatrixT >
+inline void _ReplayElimination( int                       i_pivotRowIndex,
+                                int                       i_columnBegin,
+                                int                       i_columnEnd,
+                                const EliminationRecordT& i_eliminationFactors,
+                                MatrixT&                  o_matrix )
 {
-    using MatrixEntryArrayT = MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType >;
-
-    // Cache the pivot row.
-    Matrix< 1, MatrixT::ColumnCount() > pivotRow = o_matrix.GetRow( i_pivotRowIndex );
+    // The pivot row is not modified throughout this step, so it is read in-place.
+    const typename MatrixT::ValueType* pivotRow = &o_matrix( i_pivotRowIndex, 0 );
 
     // Replay the cache and apply elimination
-    for ( const typename MatrixEntryArrayT::Entry& entry : i_eliminationFactors )
+    for ( size_t entryIndex = 0; entryIndex < i_eliminationFactors.Size(); ++entryIndex )
     {
-        // Pull cache values.
-        const MatrixIndex&                           eliminationIndex  = std::get< 0 >( entry );
-        const typename MatrixEntryArrayT::ValueType& eliminationFactor = std::get< 1 >( entry );
-
-        // Perform elimination on target row.
-        Matrix< 1, MatrixT::ColumnCount() > eliminationRow = pivotRow * eliminationFactor;
-        for ( int columnIndex : i_columnRange )
-        {
-            o_matrix( eliminationIndex.Row(), columnIndex ) -= eliminationRow( 0, columnIndex );
-        }
+        _EliminateRow( pivotRow,
+                       i_eliminationFactors.Factor( entryIndex ),
+                       i_columnBegin,
+                       i_columnEnd,
+                       &o_matrix( i_eliminationFactors.RowIndex( entryIndex ), 0 ) );
     }
 }
 
@@ -5,6 +5,9 @@
 /// Internal implementation for a fixed size array for storage of matrix indices and associated data.
 
 #include <array>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 #include <linear/linear.h>
 
@@ -150,4 +153,92 @@ private:
     std::array< Entry, CAPACITY > m_entries;
 };
 
+/// \typedef CompactIndexType
+///
+/// The narrowest unsigned integer type which can represent every index in the range [0, \p MAX_INDEX].
+template < size_t MAX_INDEX >
+using CompactIndexType = typename std::conditional<
+    MAX_INDEX <= UINT8_MAX,
+    uint8_t,
+    typename std::conditional<
+        MAX_INDEX <= UINT16_MAX,
+        uint16_t,
+        typename std::conditional< MAX_INDEX <= UINT32_MAX, uint32_t, size_t >::type >::type >::type;
+
+/// \class MatrixEliminationRecord
+///
+/// Fixed capacity record of the elimination factors applied to the rows of a matrix, during a single
+/// elimination step.
+///
+/// Only the row index of each eliminated row is stored, as the column is always the pivot column of the step.
+/// The row indices are narrowed to the smallest integer type which can address \p ROWS rows, and stored
+/// separately from the factors (structure-of-arrays) so that the factors are contiguous in memory.
+///
+/// This implementation is minimal, only to serve the needs of the elimination sub-routines - it is <em>not
+/// intended to be used as public API</em>
+template < size_t ROWS, typename ValueT >
+class MatrixEliminationRecord final
+{
+public:
+    /// \typedef ValueType
+    using ValueType = ValueT;
+
+    /// \typedef IndexType
+    ///
+    /// The compact integer type used to store row indices.
+    using IndexType = CompactIndexType< ROWS >;
+
+    /// Get the capacity (maximum number of entries which can be stored) of this record.
+    inline int Capacity() const
+    {
+        return ROWS;
+    }
+
+    /// Reset the state of this record, allowing this record to be used across mutiple passes.
+    inline void Reset()
+    {
+        m_entriesCount = 0;
+    }
+
+    /// Get the number of stored entries.
+    inline size_t Size() const
+    {
+        return m_entriesCount;
+    }
+
+    /// Record the elimination factor \p i_factor applied to row \p i_rowIndex.
+    inline void Append( size_t i_rowIndex, const ValueT& i_factor )
+    {
+        LINEAR_ASSERT( m_entriesCount < ROWS );
+        LINEAR_ASSERT( i_rowIndex < ROWS );
+        m_rowIndices[ m_entriesCount ] = static_cast< IndexType >( i_rowIndex );
+        m_factors[ m_entriesCount ]    = i_factor;
+        m_entriesCount++;
+    }
+
+    /// Get the row index of the entry at \p i_index.
+    inline size_t RowIndex( size_t i_index ) const
+    {
+        LINEAR_ASSERT( i_index < m_entriesCount );
+        return m_rowIndices[ i_index ];
+    }
+
+    /// Get the elimination factor of the entry at \p i_index.
+    inline const ValueT& Factor( size_t i_index ) const
+    {
+        LINEAR_ASSERT( i_index < m_entriesCount );
+        return m_factors[ i_index ];
+    }
+
+private:
+    /// Currently number of stored entries.
+    IndexType m_entriesCount = 0;
+
+    /// Row indices of the eliminated rows.
+    std::array< IndexType, ROWS > m_rowIndices;
+
+    /// Elimination factors, corresponding to each row index.
+    std::array< ValueT, ROWS > m_factors;
+};
+
 LINEAR_NS_CLOSE
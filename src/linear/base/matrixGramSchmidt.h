@@ -0,0 +1,176 @@
+#pragma once
+
+/// \file matrixGramSchmidt.h
+///
+/// Gram-Schmidt orthonormalization implementation details.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// Subtract the projections of row \p i_rowIndex of \p io_matrix onto all the previous (orthonormal) rows, one at a
+/// time, via the <b>modified Gram-Schmidt</b> process.
+///
+/// \return the squared length of the orthogonalized row.
+template < size_t PASSES, typename MatrixT >
+inline typename MatrixT::ValueType _OrthogonalizeRow( int i_rowIndex, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    ValueT* row = &io_matrix( i_rowIndex, 0 );
+    for ( size_t passIndex = 0; passIndex < PASSES; ++passIndex )
+    {
+        for ( int previousIndex = 0; previousIndex < i_rowIndex; ++previousIndex )
+        {
+            const ValueT* previousRow = &io_matrix( previousIndex, 0 );
+            const ValueT  projection  = _DotProduct( previousRow, row, MatrixT::ColumnCount() );
+            _EliminateRow( previousRow, projection, 0, MatrixT::ColumnCount(), row );
+        }
+    }
+
+    return _DotProduct( row, row, MatrixT::ColumnCount() );
+}
+
+/// Orthonormalize the \em rows of \p io_matrix in-place via the <b>modified Gram-Schmidt</b> process.
+///
+/// Each row has its projections onto the previous (already orthonormal) rows subtracted one at a time, using the
+/// partially orthogonalized row for each successive projection.  Rows are contiguous in memory, so each projection
+/// is a dot product followed by an axpy over contiguous entries.
+///
+/// \tparam PASSES the number of orthogonalization passes per row.  A second pass re-orthogonalizes, recovering
+/// orthogonality lost to rounding errors when the rows are nearly dependent.
+template < size_t PASSES, typename MatrixT >
+inline void _MatrixGramSchmidtRows( MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        ValueT*      row           = &io_matrix( rowIndex, 0 );
+        const ValueT squaredLength = _OrthogonalizeRow< PASSES >( rowIndex, io_matrix );
+        LINEAR_ASSERT( squaredLength != 0 );
+
+        const ValueT lengthReciprocal = 1.0 / std::sqrt( squaredLength );
+        for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            row[ columnIndex ] *= lengthReciprocal;
+        }
+    }
+}
+
+/// Complete the orthonormal rows [0, \p i_rowBegin) of \p io_matrix into an orthonormal basis, by overwriting rows
+/// [\p i_rowBegin, ROWS) with orthonormalized standard basis vectors.
+///
+/// For each new row, the standard basis vector with the largest component orthogonal to the previous rows is chosen.
+/// At least one has a squared length of 1 / COLS, so the result is well-conditioned.
+template < typename MatrixT >
+inline void _CompleteOrthonormalRows( int i_rowBegin, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    for ( int rowIndex = i_rowBegin; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        ValueT* row = &io_matrix( rowIndex, 0 );
+
+        int    basisIndex         = 0;
+        ValueT basisSquaredLength = -1;
+        for ( int candidateIndex = 0; candidateIndex < MatrixT::ColumnCount(); ++candidateIndex )
+        {
+            std::fill_n( row, MatrixT::ColumnCount(), 0 );
+            row[ candidateIndex ]               = 1;
+            const ValueT candidateSquaredLength = _OrthogonalizeRow< 2 >( rowIndex, io_matrix );
+            if ( candidateSquaredLength > basisSquaredLength )
+            {
+                basisIndex         = candidateIndex;
+                basisSquaredLength = candidateSquaredLength;
+            }
+        }
+
+        std::fill_n( row, MatrixT::ColumnCount(), 0 );
+        row[ basisIndex ] = 1;
+
+        const ValueT lengthReciprocal = 1.0 / std::sqrt( _OrthogonalizeRow< 2 >( rowIndex, io_matrix ) );
+        for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            row[ columnIndex ] *= lengthReciprocal;
+        }
+    }
+}
+
+/// Orthonormalize the columns of \p LANES matrices at once, via the <b>modified Gram-Schmidt</b> process.
+///
+/// The matrices are interleaved in \p io_lanes, such that entry (row, column) of all the matrices is
+/// stored contiguously at offset <tt>( column * ROWS + row ) * LANES</tt>.  Every operation is performed across
+/// the lanes in the innermost loop, which is vectorized by the compiler.
+///
+/// \tparam PASSES the number of orthogonalization passes per column.
+template < size_t PASSES, size_t ROWS, size_t COLS, size_t LANES, typename ValueT >
+inline void _MatrixGramSchmidtLanes( std::array< ValueT, ROWS * COLS * LANES >& io_lanes )
+{
+    auto column = [ & ]( size_t i_columnIndex ) { return io_lanes.data() + i_columnIndex * ROWS * LANES; };
+
+    std::array< ValueT, LANES > dotProducts;
+    for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+    {
+        ValueT* currentColumn = column( columnIndex );
+        for ( size_t passIndex = 0; passIndex < PASSES; ++passIndex )
+        {
+            for ( size_t previousIndex = 0; previousIndex < columnIndex; ++previousIndex )
+            {
+                const ValueT* previousColumn = column( previousIndex );
+
+                dotProducts.fill( 0 );
+                for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+                {
+                    for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                    {
+                        dotProducts[ laneIndex ] += previousColumn[ rowIndex * LANES + laneIndex ] *
+                                                    currentColumn[ rowIndex * LANES + laneIndex ];
+                    }
+                }
+
+                for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+                {
+                    for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                    {
+                        currentColumn[ rowIndex * LANES + laneIndex ] -=
+                            dotProducts[ laneIndex ] * previousColumn[ rowIndex * LANES + laneIndex ];
+                    }
+                }
+            }
+        }
+
+        dotProducts.fill( 0 );
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+            {
+                dotProducts[ laneIndex ] +=
+                    currentColumn[ rowIndex * LANES + laneIndex ] * currentColumn[ rowIndex * LANES + laneIndex ];
+            }
+        }
+
+        for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+        {
+            dotProducts[ laneIndex ] = 1.0 / std::sqrt( dotProducts[ laneIndex ] );
+        }
+
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+            {
+                currentColumn[ rowIndex * LANES + laneIndex ] *= dotProducts[ laneIndex ];
+            }
+        }
+    }
+}
+
+LINEAR_NS_CLOSE
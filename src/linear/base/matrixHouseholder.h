@@ -0,0 +1,273 @@
+#pragma once
+
+/// \file matrixHouseholder.h
+///
+/// Householder reflection implementation details.
+///
+/// A Householder reflector is represented as
+/// \f[
+/// H = I - \tau vv^T
+/// \f]
+/// where the leading entry of \f$v\f$ is implicitly 1.  The reflector \f$H_k\f$ is stored in column \f$k\f$ of a
+/// factor matrix, below the diagonal.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// Compute the Householder reflector which zeroes out the entries of column \p i_columnIndex below the diagonal
+/// of \p io_matrix.
+///
+/// The diagonal entry is replaced by the resulting value, and the entries below the diagonal by the trailing
+/// entries of \f$v\f$.
+///
+/// \return the scalar factor \f$\tau\f$ of the reflector, which is \p 0 if the column is already zero below the
+/// diagonal (in which case the reflector is the identity).
+template < typename MatrixT >
+inline typename MatrixT::ValueType _HouseholderReflector( int i_columnIndex, MatrixT& io_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    ValueT alpha             = io_matrix( i_columnIndex, i_columnIndex );
+    ValueT trailingSquareSum = 0;
+    for ( int rowIndex = i_columnIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        trailingSquareSum += io_matrix( rowIndex, i_columnIndex ) * io_matrix( rowIndex, i_columnIndex );
+    }
+
+    if ( trailingSquareSum == 0 )
+    {
+        return 0;
+    }
+
+    // The sign of beta is chosen opposite to alpha, to avoid cancellation in alpha - beta.
+    ValueT norm = std::sqrt( alpha * alpha + trailingSquareSum );
+    ValueT beta = alpha >= 0 ? -norm : norm;
+
+    ValueT scale = 1.0 / ( alpha - beta );
+    for ( int rowIndex = i_columnIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        io_matrix( rowIndex, i_columnIndex ) *= scale;
+    }
+
+    io_matrix( i_columnIndex, i_columnIndex ) = beta;
+    return ( beta - alpha ) / beta;
+}
+
+/// Apply the Householder reflector \f$H_k\f$ stored in \p i_factor from the left, onto the columns in the range
+/// [\p i_columnBegin, \p i_columnEnd) of \p io_matrix.
+///
+/// \p i_factor and \p io_matrix may refer to the same matrix, as long as the column range excludes column
+/// \p i_reflectorIndex.
+template < typename FactorT, typename MatrixT >
+inline void _ApplyHouseholderReflector( const FactorT&                     i_factor,
+                                        int                                i_reflectorIndex,
+                                        const typename FactorT::ValueType& i_tau,
+                                        int                                i_columnBegin,
+                                        int                                i_columnEnd,
+                                        MatrixT&                           io_matrix )
+{
+    static_assert( FactorT::RowCount() == MatrixT::RowCount() );
+    using ValueT = typename MatrixT::ValueType;
+
+    if ( i_tau == 0 )
+    {
+        return;
+    }
+
+    // w = v^T * A, accumulated row by row.
+    std::array< ValueT, MatrixT::ColumnCount() > product;
+    std::copy( &io_matrix( i_reflectorIndex, 0 ) + i_columnBegin,
+               &io_matrix( i_reflectorIndex, 0 ) + i_columnEnd,
+               product.data() + i_columnBegin );
+    for ( int rowIndex = i_reflectorIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        _EliminateRow( &io_matrix( rowIndex, 0 ),
+                       -i_factor( rowIndex, i_reflectorIndex ),
+                       i_columnBegin,
+                       i_columnEnd,
+                       product.data() );
+    }
+
+    // A -= tau * v * w
+    _EliminateRow( product.data(), i_tau, i_columnBegin, i_columnEnd, &io_matrix( i_reflectorIndex, 0 ) );
+    for ( int rowIndex = i_reflectorIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        _EliminateRow( product.data(),
+                       i_tau * i_factor( rowIndex, i_reflectorIndex ),
+                       i_columnBegin,
+                       i_columnEnd,
+                       &io_matrix( rowIndex, 0 ) );
+    }
+}
+
+/// Apply the transpose of the product of the Householder reflectors \f$H_b ... H_{e-1}\f$ stored in \p i_factor,
+/// in the range [\p i_reflectorBegin, \p i_reflectorEnd), from the left onto the columns in the range
+/// [\p i_columnBegin, \p i_columnEnd) of \p io_matrix.
+///
+/// The block of reflectors is applied at once using its compact WY representation:
+/// \f[
+/// H_b ... H_{e-1} = I - VTV^T
+/// \f]
+/// where \f$V\f$ holds the reflector vectors and \f$T\f$ is upper triangular, so that the bulk of the work is
+/// performed as matrix products rather than a sequence of rank 1 updates.
+///
+/// \tparam BLOCK_SIZE the maximum number of reflectors in the block.
+template < size_t BLOCK_SIZE, typename FactorT, typename TauT, typename MatrixT >
+inline void _ApplyHouseholderBlockTranspose( const FactorT& i_factor,
+                                             int            i_reflectorBegin,
+                                             int            i_reflectorEnd,
+                                             const TauT&    i_tau,
+                                             int            i_columnBegin,
+                                             int            i_columnEnd,
+                                             MatrixT&       io_matrix )
+{
+    static_assert( FactorT::RowCount() == MatrixT::RowCount() );
+    using ValueT = typename MatrixT::ValueType;
+
+    const int blockSize = i_reflectorEnd - i_reflectorBegin;
+    LINEAR_ASSERT( blockSize <= int( BLOCK_SIZE ) );
+
+    // Entry of V, with the implicit unit diagonal and zeroes above.
+    auto reflectorEntry = [ & ]( int i_rowIndex, int i_blockIndex ) -> ValueT {
+        const int reflectorIndex = i_reflectorBegin + i_blockIndex;
+        if ( i_rowIndex == reflectorIndex )
+        {
+            return 1;
+        }
+        return i_rowIndex > reflectorIndex ? i_factor( i_rowIndex, reflectorIndex ) : 0;
+    };
+
+    // Form the upper triangular factor T, one column at a time:
+    // T(0:i, i) = -tau_i * T(0:i, 0:i) * V(:, 0:i)^T * v_i
+    std::array< ValueT, BLOCK_SIZE * BLOCK_SIZE > triangular{};
+    std::array< ValueT, BLOCK_SIZE >              reflectorProducts;
+    for ( int blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+    {
+        const int    reflectorIndex = i_reflectorBegin + blockIndex;
+        const ValueT tau            = i_tau[ reflectorIndex ];
+        for ( int previousIndex = 0; previousIndex < blockIndex; ++previousIndex )
+        {
+            const int previousReflectorIndex = i_reflectorBegin + previousIndex;
+            ValueT    product                = reflectorEntry( reflectorIndex, previousIndex );
+            for ( int rowIndex = reflectorIndex + 1; rowIndex < FactorT::RowCount(); ++rowIndex )
+            {
+                product += i_factor( rowIndex, previousReflectorIndex ) * i_factor( rowIndex, reflectorIndex );
+            }
+            reflectorProducts[ previousIndex ] = product;
+        }
+
+        for ( int previousIndex = 0; previousIndex < blockIndex; ++previousIndex )
+        {
+            ValueT product = 0;
+            for ( int innerIndex = previousIndex; innerIndex < blockIndex; ++innerIndex )
+            {
+                product += triangular[ previousIndex * BLOCK_SIZE + innerIndex ] * reflectorProducts[ innerIndex ];
+            }
+            triangular[ previousIndex * BLOCK_SIZE + blockIndex ] = -tau * product;
+        }
+
+        triangular[ blockIndex * BLOCK_SIZE + blockIndex ] = tau;
+    }
+
+    // W = V^T * A, accumulated row by row.
+    std::array< ValueT, BLOCK_SIZE * MatrixT::ColumnCount() > product{};
+    for ( int rowIndex = i_reflectorBegin; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        const int blockEnd = std::min( blockSize, rowIndex - i_reflectorBegin + 1 );
+        for ( int blockIndex = 0; blockIndex < blockEnd; ++blockIndex )
+        {
+            _EliminateRow( &io_matrix( rowIndex, 0 ),
+                           -reflectorEntry( rowIndex, blockIndex ),
+                           i_columnBegin,
+                           i_columnEnd,
+                           &product[ blockIndex * MatrixT::ColumnCount() ] );
+        }
+    }
+
+    // W = T^T * W, in-place from the last row upwards, as row i only depends on rows 0 to i.
+    for ( int blockIndex = blockSize - 1; blockIndex >= 0; --blockIndex )
+    {
+        ValueT* productRow = &product[ blockIndex * MatrixT::ColumnCount() ];
+        for ( int columnIndex = i_columnBegin; columnIndex < i_columnEnd; ++columnIndex )
+        {
+            productRow[ columnIndex ] *= triangular[ blockIndex * BLOCK_SIZE + blockIndex ];
+        }
+
+        for ( int previousIndex = 0; previousIndex < blockIndex; ++previousIndex )
+        {
+            _EliminateRow( &product[ previousIndex * MatrixT::ColumnCount() ],
+                           -triangular[ previousIndex * BLOCK_SIZE + blockIndex ],
+                           i_columnBegin,
+                           i_columnEnd,
+                           productRow );
+        }
+    }
+
+    // A -= V * W
+    for ( int rowIndex = i_reflectorBegin; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        const int blockEnd = std::min( blockSize, rowIndex - i_reflectorBegin + 1 );
+        for ( int blockIndex = 0; blockIndex < blockEnd; ++blockIndex )
+        {
+            _EliminateRow( &product[ blockIndex * MatrixT::ColumnCount() ],
+                           reflectorEntry( rowIndex, blockIndex ),
+                           i_columnBegin,
+                           i_columnEnd,
+                           &io_matrix( rowIndex, 0 ) );
+        }
+    }
+}
+
+/// Factor \p io_matrix into \f$QR\f$ in-place via Householder reflections, where \f$Q\f$ is orthogonal and
+/// \f$R\f$ is upper triangular.
+///
+/// \f$R\f$ replaces the upper triangular part of \p io_matrix, and the reflector vectors the part below the
+/// diagonal.  The scalar factors of the reflectors are stored in \p o_tau.
+///
+/// The columns are factored in panels of \p BLOCK_SIZE.  Each panel is factored one reflector at a time, then
+/// applied to the trailing columns as a single block.
+///
+/// \tparam BLOCK_SIZE the number of columns in a panel.
+template < size_t BLOCK_SIZE, typename MatrixT, typename TauT >
+inline void _MatrixHouseholderQR( MatrixT& io_matrix, TauT& o_tau )
+{
+    static_assert( MatrixT::RowCount() >= MatrixT::ColumnCount() );
+
+    for ( int panelBegin = 0; panelBegin < MatrixT::ColumnCount(); panelBegin += BLOCK_SIZE )
+    {
+        const int panelEnd = std::min< int >( panelBegin + BLOCK_SIZE, MatrixT::ColumnCount() );
+
+        // Factor the panel.
+        for ( int columnIndex = panelBegin; columnIndex < panelEnd; ++columnIndex )
+        {
+            o_tau[ columnIndex ] = _HouseholderReflector( columnIndex, io_matrix );
+            _ApplyHouseholderReflector( io_matrix,
+                                        columnIndex,
+                                        o_tau[ columnIndex ],
+                                        columnIndex + 1 /* columnBegin */,
+                                        panelEnd /* columnEnd */,
+                                        io_matrix );
+        }
+
+        // Update the trailing columns.
+        if constexpr ( MatrixT::ColumnCount() > BLOCK_SIZE )
+        {
+            if ( panelEnd < MatrixT::ColumnCount() )
+            {
+                _ApplyHouseholderBlockTranspose< BLOCK_SIZE >(
+                    io_matrix, panelBegin, panelEnd, o_tau, panelEnd, MatrixT::ColumnCount(), io_matrix );
+            }
+        }
+    }
+}
+
+LINEAR_NS_CLOSE
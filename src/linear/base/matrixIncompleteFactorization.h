@@ -0,0 +1,141 @@
+#pragma once
+
+/// \file matrixIncompleteFactorization.h
+///
+/// Incomplete LU and Cholesky factorization implementation details.
+///
+/// An incomplete factorization only keeps the entries of the factors which lie in the sparsity pattern of the
+/// factored matrix, dropping any fill-in, such that it costs as little as the non-zero entries both to compute and to
+/// solve with.  The pattern is analyzed once, and re-used to factor any matrix sharing it.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// \struct _SparsityPattern
+///
+/// The positions of the non-zero entries of an \p N by \p N matrix, stored row by row in ascending column order.
+/// The diagonal entries are always part of the pattern.
+template < int N >
+struct _SparsityPattern
+{
+    /// Record the pattern of the non-zero entries of \p i_matrix.
+    template < typename MatrixT >
+    void Analyze( const MatrixT& i_matrix )
+    {
+        static_assert( MatrixT::RowCount() == N && MatrixT::ColumnCount() == N );
+
+        int entryCount = 0;
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            m_rowOffsets[ rowIndex ] = entryCount;
+            for ( int columnIndex = 0; columnIndex < N; ++columnIndex )
+            {
+                if ( columnIndex == rowIndex )
+                {
+                    m_diagonalOffsets[ rowIndex ] = entryCount;
+                }
+                else if ( i_matrix( rowIndex, columnIndex ) == 0 )
+                {
+                    continue;
+                }
+                m_columnIndices[ entryCount++ ] = columnIndex;
+            }
+        }
+        m_rowOffsets[ N ] = entryCount;
+    }
+
+    /// The offset of the first entry of each row into m_columnIndices, followed by the total number of entries.
+    std::array< int, N + 1 > m_rowOffsets{};
+
+    /// The offset of the diagonal entry of each row into m_columnIndices.
+    std::array< int, N > m_diagonalOffsets{};
+
+    /// The column index of each entry.
+    std::array< int, N * N > m_columnIndices{};
+};
+
+/// Factor \p io_matrix into \f$LU\f$ in-place, restricted to \p i_pattern, via the row-wise (IKJ) variant of
+/// Gaussian elimination without pivoting.  The entries outside of the pattern are expected to be zero.
+///
+/// The unit lower triangular \f$L\f$ is stored below the diagonal, and \f$U\f$ on and above it.
+///
+/// \return \p false if a pivot is zero.
+template < int N, typename MatrixT >
+inline bool _MatrixIncompleteLU( const _SparsityPattern< N >& i_pattern, MatrixT& io_matrix )
+{
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        const int rowEnd      = i_pattern.m_rowOffsets[ rowIndex + 1 ];
+        const int diagonalEnd = i_pattern.m_diagonalOffsets[ rowIndex ];
+        for ( int offset = i_pattern.m_rowOffsets[ rowIndex ]; offset < diagonalEnd; ++offset )
+        {
+            // The entries of the pivot row outside of its pattern are zero, so only the pattern of this row matters.
+            const int pivotIndex = i_pattern.m_columnIndices[ offset ];
+            io_matrix( rowIndex, pivotIndex ) /= io_matrix( pivotIndex, pivotIndex );
+
+            const auto factor = io_matrix( rowIndex, pivotIndex );
+            for ( int nextOffset = offset + 1; nextOffset < rowEnd; ++nextOffset )
+            {
+                const int columnIndex = i_pattern.m_columnIndices[ nextOffset ];
+                io_matrix( rowIndex, columnIndex ) -= factor * io_matrix( pivotIndex, columnIndex );
+            }
+        }
+
+        if ( io_matrix( rowIndex, rowIndex ) == 0 )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Factor the symmetric \p io_matrix into \f$LL^T\f$ in-place, restricted to \p i_pattern, via the row-wise
+/// Cholesky-Crout algorithm.  Only the lower triangle is read, and the entries outside of the pattern are expected
+/// to be zero.
+///
+/// \f$L\f$ is stored on and below the diagonal, leaving the strictly upper triangle untouched.
+///
+/// \return \p false if the incomplete factorization breaks down on a non-positive pivot.
+template < int N, typename MatrixT >
+inline bool _MatrixIncompleteCholesky( const _SparsityPattern< N >& i_pattern, MatrixT& io_matrix )
+{
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        const int rowBegin    = i_pattern.m_rowOffsets[ rowIndex ];
+        const int diagonalEnd = i_pattern.m_diagonalOffsets[ rowIndex ];
+        for ( int offset = rowBegin; offset < diagonalEnd; ++offset )
+        {
+            // L(i, j) = ( A(i, j) - sum_k L(i, k) * L(j, k) ) / L(j, j), where L(j, k) is zero outside the pattern.
+            const int columnIndex = i_pattern.m_columnIndices[ offset ];
+            auto      value       = io_matrix( rowIndex, columnIndex );
+            for ( int previousOffset = rowBegin; previousOffset < offset; ++previousOffset )
+            {
+                const int previousIndex = i_pattern.m_columnIndices[ previousOffset ];
+                value -= io_matrix( rowIndex, previousIndex ) * io_matrix( columnIndex, previousIndex );
+            }
+            io_matrix( rowIndex, columnIndex ) = value / io_matrix( columnIndex, columnIndex );
+        }
+
+        auto diagonal = io_matrix( rowIndex, rowIndex );
+        for ( int offset = rowBegin; offset < diagonalEnd; ++offset )
+        {
+            const int columnIndex = i_pattern.m_columnIndices[ offset ];
+            diagonal -= io_matrix( rowIndex, columnIndex ) * io_matrix( rowIndex, columnIndex );
+        }
+        if ( !( diagonal > 0 ) )
+        {
+            return false;
+        }
+        io_matrix( rowIndex, rowIndex ) = std::sqrt( diagonal );
+    }
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
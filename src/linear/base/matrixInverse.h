@@ -13,62 +13,69 @@
 
 LINEAR_NS_OPEN
 
-/// Compute the inverse of a matrix via Gauss-Jordan elimination.
+/// Compute the inverse of a matrix via Gauss-Jordan elimination, using caller-provided scratch memory.
+///
+/// \p io_matrix is the working matrix, which is initially the matrix to invert, and is reduced throughout
+/// elimination.  \p o_eliminationFactors is the scratch record of a single elimination step.
+///
 /// If elimination fails due to \p current matrix being \em singular, the value of \p o_inverse will be un-defined.
-template < typename MatrixT >
-inline bool _MatrixInverse( const MatrixT& i_matrix, MatrixT& o_inverse )
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT, typename MatrixT, typename EliminationRecordT >
+inline bool _MatrixInverse( MatrixT& io_matrix, MatrixT& o_inverse, EliminationRecordT& o_eliminationFactors )
 {
     static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
 
-    // Left-hand-side working matrix.  This will assume the identity matrix after the full Gauss-Jordan elimination.
-    MatrixT matrix = i_matrix;
-
     // This matrix begins as the identity, and will assume the inverse after elimiination.
     o_inverse = MatrixT::Identity();
 
-    // Use cache to record on i_matrix and replay on o_inverse.
-    MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+    // Use cache to record on io_matrix and replay on o_inverse.
+    o_eliminationFactors.Reset();
 
     // Gauss step: E*A -> U
     for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount() - 1; ++pivotIndex )
     {
-        // Check that the current pivot is non-zero.
-        if ( matrix( pivotIndex, pivotIndex ) == 0 )
+        // Select a pivot, exchanging rows if required.
+        if constexpr ( _ExchangesRows< PivotT >() )
         {
-            // Try to find a row below with a non-zero pivot to exchange.
-            int exchangedRow = _FindAndPerformRowExchange( pivotIndex, pivotIndex, matrix );
-            if ( exchangedRow != -1 )
-            {
-                RowExchange( pivotIndex, exchangedRow, o_inverse );
-            }
-            else
+            int exchangedRow = _FindAndPerformRowExchange< PivotT >( pivotIndex, pivotIndex, io_matrix );
+            if ( exchangedRow == -1 )
             {
                 // A matrix is invertible if and only if all its columns are independent.  Failure to find a
                 // row to exchange to produce a pivot means that this column is singular (it is a combination of
                 // the previous columns), thus this matrix is not generally invertible.
                 return false;
             }
+            else if ( exchangedRow != pivotIndex )
+            {
+                RowExchange( pivotIndex, exchangedRow, o_inverse );
+            }
+        }
+        else if ( io_matrix( pivotIndex, pivotIndex ) == 0 )
+        {
+            return false;
         }
 
-        // Record the elimination on matrix, then replay onto o_inverse.
+        // Record the elimination on io_matrix, then replay onto o_inverse.
         _RecordElimination( pivotIndex,
                             pivotIndex,
                             IntRange( pivotIndex + 1, MatrixT::RowCount() ) /* rowRange */,
-                            IntRange( pivotIndex, MatrixT::ColumnCount() ) /* columnRange */,
-                            eliminationFactors,
-                            matrix );
+                            pivotIndex /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
         _ReplayElimination( pivotIndex,
-                            pivotIndex,
-                            /* columnRange */ IntRange( 0, MatrixT::ColumnCount() ),
-                            eliminationFactors,
+                            0 /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
                             o_inverse );
 
         // Reset the cache for the next iteration.
-        eliminationFactors.Reset();
+        o_eliminationFactors.Reset();
     }
 
     // Check the last pivot exists!
-    if ( matrix( MatrixT::RowCount() - 1, MatrixT::RowCount() - 1 ) == 0 )
+    if ( io_matrix( MatrixT::RowCount() - 1, MatrixT::RowCount() - 1 ) == 0 )
     {
         return false;
     }
@@ -76,27 +83,28 @@ inline bool _MatrixInverse( const MatrixT& i_matrix, MatrixT& o_inverse )
     // Jordan Step step: U*E -> D
     for ( int pivotIndex = MatrixT::RowCount() - 1; pivotIndex > 0; --pivotIndex )
     {
-        // Record the elimination on matrix, then replay onto o_inverse.
+        // Record the elimination on io_matrix, then replay onto o_inverse.
         _RecordElimination( pivotIndex,
                             pivotIndex,
                             IntRange( pivotIndex - 1, -1 ) /* rowRange */,
-                            IntRange( pivotIndex, -1 ) /* columnRange */,
-                            eliminationFactors,
-                            matrix );
+                            0 /* columnBegin */,
+                            pivotIndex + 1 /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
         _ReplayElimination( pivotIndex,
-                            pivotIndex,
-                            /* columnRange */ IntRange( MatrixT::ColumnCount() - 1, -1 ),
-                            eliminationFactors,
+                            0 /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
                             o_inverse );
 
         // Reset the cache for the next iteration.
-        eliminationFactors.Reset();
+        o_eliminationFactors.Reset();
     }
 
     // Divide rows by diagonal pivot values.
     for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
     {
-        typename MatrixT::ValueType& pivotValue        = matrix( pivotIndex, pivotIndex );
+        typename MatrixT::ValueType& pivotValue        = io_matrix( pivotIndex, pivotIndex );
         typename MatrixT::ValueType  pivotValueInverse = 1.0 / pivotValue;
         for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); columnIndex++ )
         {
@@ -108,4 +116,18 @@ inline bool _MatrixInverse( const MatrixT& i_matrix, MatrixT& o_inverse )
     return true;
 }
 
+/// Compute the inverse of a matrix via Gauss-Jordan elimination.
+/// If elimination fails due to \p current matrix being \em singular, the value of \p o_inverse will be un-defined.
+template < typename PivotT, typename MatrixT >
+inline bool _MatrixInverse( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    // Working copy of the input matrix.
+    typename MatrixT::MatrixType matrix = i_matrix;
+
+    // Record of elimination factors.
+    MatrixEliminationRecord< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+
+    return _MatrixInverse< PivotT >( matrix, o_inverse, eliminationFactors );
+}
+
 LINEAR_NS_CLOSE
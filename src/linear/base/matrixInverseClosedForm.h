@@ -0,0 +1,356 @@
+#pragma once
+
+/// \file matrixInverseClosedForm.h
+///
+/// Closed-form matrix inverse implementation details, for small matrices.
+///
+/// The inverse is computed as the adjugate (the transposed matrix of cofactors) divided by the determinant.
+/// For small matrices this is a fixed sequence of multiply-adds, without the branches and bookkeeping of
+/// elimination.
+
+#include <linear/base/diagnostic.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+/// \def LINEAR_INVERSE_SSE
+///
+/// Whether the SSE kernel of the single precision 4x4 inverse is compiled.  GCC and Clang define \p __SSE__, whereas
+/// MSVC reports SSE through \p _M_X64, or \p _M_IX86_FP on 32-bit x86.
+#if defined( __SSE__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 1 )
+#define LINEAR_INVERSE_SSE
+#include <xmmintrin.h>
+#endif
+
+LINEAR_NS_OPEN
+
+/// Check if the matrix type \p MatrixT has a closed-form inverse kernel.
+template < typename MatrixT >
+constexpr inline bool _HasClosedFormInverse()
+{
+    return MatrixT::RowCount() == MatrixT::ColumnCount() && MatrixT::RowCount() >= 2 && MatrixT::RowCount() <= 4;
+}
+
+/// Check if \p i_determinant, computed in closed-form from \p i_matrix, is negligible, such that \p i_matrix is
+/// treated as singular.
+///
+/// By Hadamard's inequality the determinant is bounded by the product of the norms of the rows, with equality for
+/// orthogonal rows.  The rounding errors of the cofactor expansion are in the order of \f$n\epsilon\f$ relative to
+/// that bound, so for an exactly singular matrix the computed determinant rarely rounds to \p 0, but is only
+/// non-zero within those errors.  Matrices of integral values are only singular for a determinant of exactly \p 0.
+template < typename MatrixT >
+inline bool _IsNegligibleDeterminant( const typename MatrixT::ValueType& i_determinant, const MatrixT& i_matrix )
+{
+    using ValueT = typename MatrixT::ValueType;
+    if constexpr ( std::is_integral< ValueT >::value )
+    {
+        return i_determinant == 0;
+    }
+    else
+    {
+        ValueT bound = MatrixT::RowCount() * std::numeric_limits< ValueT >::epsilon();
+        for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            ValueT squaredNorm = 0;
+            for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+            {
+                squaredNorm += i_matrix( rowIndex, columnIndex ) * i_matrix( rowIndex, columnIndex );
+            }
+            bound *= std::sqrt( squaredNorm );
+        }
+
+        // Also treats a NaN determinant as negligible.
+        return !( std::abs( i_determinant ) > bound );
+    }
+}
+
+/// Compute the inverse of a 2x2 matrix in closed-form.
+///
+/// \return \p true if \p i_matrix is invertible.  \p false if its determinant is negligible, in which case
+/// \p o_inverse is un-modified.
+template < typename MatrixT >
+inline bool _MatrixInverse2x2( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    const ValueT determinant = i_matrix( 0, 0 ) * i_matrix( 1, 1 ) - i_matrix( 0, 1 ) * i_matrix( 1, 0 );
+    if ( _IsNegligibleDeterminant( determinant, i_matrix ) )
+    {
+        return false;
+    }
+
+    const ValueT determinantReciprocal = 1.0 / determinant;
+    const ValueT entries[ 4 ]          = {
+        i_matrix( 1, 1 ) * determinantReciprocal,
+        -i_matrix( 0, 1 ) * determinantReciprocal,
+        -i_matrix( 1, 0 ) * determinantReciprocal,
+        i_matrix( 0, 0 ) * determinantReciprocal,
+    };
+
+    for ( size_t entryIndex = 0; entryIndex < 4; ++entryIndex )
+    {
+        o_inverse[ entryIndex ] = entries[ entryIndex ];
+    }
+
+    return true;
+}
+
+/// Compute the inverse of a 3x3 matrix in closed-form.
+///
+/// \return \p true if \p i_matrix is invertible.  \p false if its determinant is negligible, in which case
+/// \p o_inverse is un-modified.
+template < typename MatrixT >
+inline bool _MatrixInverse3x3( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    // Cofactors of the first row.
+    const ValueT cofactor00 = i_matrix( 1, 1 ) * i_matrix( 2, 2 ) - i_matrix( 1, 2 ) * i_matrix( 2, 1 );
+    const ValueT cofactor01 = i_matrix( 1, 2 ) * i_matrix( 2, 0 ) - i_matrix( 1, 0 ) * i_matrix( 2, 2 );
+    const ValueT cofactor02 = i_matrix( 1, 0 ) * i_matrix( 2, 1 ) - i_matrix( 1, 1 ) * i_matrix( 2, 0 );
+
+    const ValueT determinant =
+        i_matrix( 0, 0 ) * cofactor00 + i_matrix( 0, 1 ) * cofactor01 + i_matrix( 0, 2 ) * cofactor02;
+    if ( _IsNegligibleDeterminant( determinant, i_matrix ) )
+    {
+        return false;
+    }
+
+    const ValueT determinantReciprocal = 1.0 / determinant;
+    const ValueT entries[ 9 ]          = {
+        cofactor00 * determinantReciprocal,
+        ( i_matrix( 0, 2 ) * i_matrix( 2, 1 ) - i_matrix( 0, 1 ) * i_matrix( 2, 2 ) ) * determinantReciprocal,
+        ( i_matrix( 0, 1 ) * i_matrix( 1, 2 ) - i_matrix( 0, 2 ) * i_matrix( 1, 1 ) ) * determinantReciprocal,
+        cofactor01 * determinantReciprocal,
+        ( i_matrix( 0, 0 ) * i_matrix( 2, 2 ) - i_matrix( 0, 2 ) * i_matrix( 2, 0 ) ) * determinantReciprocal,
+        ( i_matrix( 0, 2 ) * i_matrix( 1, 0 ) - i_matrix( 0, 0 ) * i_matrix( 1, 2 ) ) * determinantReciprocal,
+        cofactor02 * determinantReciprocal,
+        ( i_matrix( 0, 1 ) * i_matrix( 2, 0 ) - i_matrix( 0, 0 ) * i_matrix( 2, 1 ) ) * determinantReciprocal,
+        ( i_matrix( 0, 0 ) * i_matrix( 1, 1 ) - i_matrix( 0, 1 ) * i_matrix( 1, 0 ) ) * determinantReciprocal,
+    };
+
+    for ( size_t entryIndex = 0; entryIndex < 9; ++entryIndex )
+    {
+        o_inverse[ entryIndex ] = entries[ entryIndex ];
+    }
+
+    return true;
+}
+
+/// Compute the inverse of a 4x4 matrix in closed-form.
+///
+/// The cofactors are expanded from the 2x2 minors of the top two rows and bottom two rows (Laplace expansion),
+/// which are each shared between several cofactors.
+///
+/// \return \p true if \p i_matrix is invertible.  \p false if its determinant is negligible, in which case
+/// \p o_inverse is un-modified.
+template < typename MatrixT >
+inline bool _MatrixInverse4x4( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    const ValueT a00 = i_matrix( 0, 0 ), a01 = i_matrix( 0, 1 ), a02 = i_matrix( 0, 2 ), a03 = i_matrix( 0, 3 );
+    const ValueT a10 = i_matrix( 1, 0 ), a11 = i_matrix( 1, 1 ), a12 = i_matrix( 1, 2 ), a13 = i_matrix( 1, 3 );
+    const ValueT a20 = i_matrix( 2, 0 ), a21 = i_matrix( 2, 1 ), a22 = i_matrix( 2, 2 ), a23 = i_matrix( 2, 3 );
+    const ValueT a30 = i_matrix( 3, 0 ), a31 = i_matrix( 3, 1 ), a32 = i_matrix( 3, 2 ), a33 = i_matrix( 3, 3 );
+
+    // 2x2 minors of the top two rows.
+    const ValueT s0 = a00 * a11 - a10 * a01;
+    const ValueT s1 = a00 * a12 - a10 * a02;
+    const ValueT s2 = a00 * a13 - a10 * a03;
+    const ValueT s3 = a01 * a12 - a11 * a02;
+    const ValueT s4 = a01 * a13 - a11 * a03;
+    const ValueT s5 = a02 * a13 - a12 * a03;
+
+    // 2x2 minors of the bottom two rows.
+    const ValueT c5 = a22 * a33 - a32 * a23;
+    const ValueT c4 = a21 * a33 - a31 * a23;
+    const ValueT c3 = a21 * a32 - a31 * a22;
+    const ValueT c2 = a20 * a33 - a30 * a23;
+    const ValueT c1 = a20 * a32 - a30 * a22;
+    const ValueT c0 = a20 * a31 - a30 * a21;
+
+    const ValueT determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    if ( _IsNegligibleDeterminant( determinant, i_matrix ) )
+    {
+        return false;
+    }
+
+    const ValueT reciprocal = 1.0 / determinant;
+
+    o_inverse( 0, 0 ) = ( a11 * c5 - a12 * c4 + a13 * c3 ) * reciprocal;
+    o_inverse( 0, 1 ) = ( -a01 * c5 + a02 * c4 - a03 * c3 ) * reciprocal;
+    o_inverse( 0, 2 ) = ( a31 * s5 - a32 * s4 + a33 * s3 ) * reciprocal;
+    o_inverse( 0, 3 ) = ( -a21 * s5 + a22 * s4 - a23 * s3 ) * reciprocal;
+
+    o_inverse( 1, 0 ) = ( -a10 * c5 + a12 * c2 - a13 * c1 ) * reciprocal;
+    o_inverse( 1, 1 ) = ( a00 * c5 - a02 * c2 + a03 * c1 ) * reciprocal;
+    o_inverse( 1, 2 ) = ( -a30 * s5 + a32 * s2 - a33 * s1 ) * reciprocal;
+    o_inverse( 1, 3 ) = ( a20 * s5 - a22 * s2 + a23 * s1 ) * reciprocal;
+
+    o_inverse( 2, 0 ) = ( a10 * c4 - a11 * c2 + a13 * c0 ) * reciprocal;
+    o_inverse( 2, 1 ) = ( -a00 * c4 + a01 * c2 - a03 * c0 ) * reciprocal;
+    o_inverse( 2, 2 ) = ( a30 * s4 - a31 * s2 + a33 * s0 ) * reciprocal;
+    o_inverse( 2, 3 ) = ( -a20 * s4 + a21 * s2 - a23 * s0 ) * reciprocal;
+
+    o_inverse( 3, 0 ) = ( -a10 * c3 + a11 * c1 - a12 * c0 ) * reciprocal;
+    o_inverse( 3, 1 ) = ( a00 * c3 - a01 * c1 + a02 * c0 ) * reciprocal;
+    o_inverse( 3, 2 ) = ( -a30 * s3 + a31 * s1 - a32 * s0 ) * reciprocal;
+    o_inverse( 3, 3 ) = ( a20 * s3 - a21 * s1 + a22 * s0 ) * reciprocal;
+
+    return true;
+}
+
+#if defined( LINEAR_INVERSE_SSE )
+
+/// \def LINEAR_SSE_SWIZZLE( vector, x, y, z, w )
+///
+/// Select the components \p x, \p y, \p z, \p w from \p vector.
+#define LINEAR_SSE_SWIZZLE( vector, x, y, z, w ) _mm_shuffle_ps( vector, vector, _MM_SHUFFLE( w, z, y, x ) )
+
+/// \def LINEAR_SSE_SHUFFLE( vectorA, vectorB, x, y, z, w )
+///
+/// Select the components \p x, \p y from \p vectorA, and \p z, \p w from \p vectorB.
+#define LINEAR_SSE_SHUFFLE( vectorA, vectorB, x, y, z, w )                                                             \
+    _mm_shuffle_ps( vectorA, vectorB, _MM_SHUFFLE( w, z, y, x ) )
+
+/// Multiply two 2x2 row-major matrices, each packed into a single vector: \f$AB\f$.
+inline __m128 _Matrix2x2MultiplySSE( __m128 i_matrixA, __m128 i_matrixB )
+{
+    const __m128 productA = _mm_mul_ps( i_matrixA, LINEAR_SSE_SWIZZLE( i_matrixB, 0, 3, 0, 3 ) );
+    const __m128 productB =
+        _mm_mul_ps( LINEAR_SSE_SWIZZLE( i_matrixA, 1, 0, 3, 2 ), LINEAR_SSE_SWIZZLE( i_matrixB, 2, 1, 2, 1 ) );
+    return _mm_add_ps( productA, productB );
+}
+
+/// Multiply the adjugate of a 2x2 matrix with another: \f$A^{\#}B\f$.
+inline __m128 _Matrix2x2AdjugateMultiplySSE( __m128 i_matrixA, __m128 i_matrixB )
+{
+    const __m128 productA = _mm_mul_ps( LINEAR_SSE_SWIZZLE( i_matrixA, 3, 3, 0, 0 ), i_matrixB );
+    const __m128 productB =
+        _mm_mul_ps( LINEAR_SSE_SWIZZLE( i_matrixA, 1, 1, 2, 2 ), LINEAR_SSE_SWIZZLE( i_matrixB, 2, 3, 0, 1 ) );
+    return _mm_sub_ps( productA, productB );
+}
+
+/// Multiply a 2x2 matrix with the adjugate of another: \f$AB^{\#}\f$.
+inline __m128 _Matrix2x2MultiplyAdjugateSSE( __m128 i_matrixA, __m128 i_matrixB )
+{
+    const __m128 productA = _mm_mul_ps( i_matrixA, LINEAR_SSE_SWIZZLE( i_matrixB, 3, 0, 3, 0 ) );
+    const __m128 productB =
+        _mm_mul_ps( LINEAR_SSE_SWIZZLE( i_matrixA, 1, 0, 3, 2 ), LINEAR_SSE_SWIZZLE( i_matrixB, 2, 1, 2, 1 ) );
+    return _mm_sub_ps( productA, productB );
+}
+
+/// Compute the inverse of a 4x4 single precision matrix with SSE.
+///
+/// The matrix is partitioned into 2x2 blocks
+/// \f[
+/// M = \begin{bmatrix} A & B \\ C & D \end{bmatrix}
+/// \f]
+/// each packed into a single vector, and the blocks of the inverse are computed through 2x2 adjugates.
+///
+/// \return \p true if \p i_matrix is invertible.  \p false if its determinant is negligible, in which case
+/// \p o_inverse is un-modified.
+inline bool _MatrixInverse4x4SSE( const Matrix< 4, 4, float >& i_matrix, Matrix< 4, 4, float >& o_inverse )
+{
+    const __m128 row0 = _mm_loadu_ps( &i_matrix[ 0 ] );
+    const __m128 row1 = _mm_loadu_ps( &i_matrix[ 4 ] );
+    const __m128 row2 = _mm_loadu_ps( &i_matrix[ 8 ] );
+    const __m128 row3 = _mm_loadu_ps( &i_matrix[ 12 ] );
+
+    // 2x2 blocks.
+    const __m128 a = _mm_movelh_ps( row0, row1 );
+    const __m128 b = _mm_movehl_ps( row1, row0 );
+    const __m128 c = _mm_movelh_ps( row2, row3 );
+    const __m128 d = _mm_movehl_ps( row3, row2 );
+
+    // Block determinants (|A|, |B|, |C|, |D|).
+    const __m128 diagonalProducts =
+        _mm_mul_ps( LINEAR_SSE_SHUFFLE( row0, row2, 0, 2, 0, 2 ), LINEAR_SSE_SHUFFLE( row1, row3, 1, 3, 1, 3 ) );
+    const __m128 antiDiagonalProducts =
+        _mm_mul_ps( LINEAR_SSE_SHUFFLE( row0, row2, 1, 3, 1, 3 ), LINEAR_SSE_SHUFFLE( row1, row3, 0, 2, 0, 2 ) );
+    const __m128 blockDeterminants = _mm_sub_ps( diagonalProducts, antiDiagonalProducts );
+    const __m128 determinantA = LINEAR_SSE_SWIZZLE( blockDeterminants, 0, 0, 0, 0 );
+    const __m128 determinantB = LINEAR_SSE_SWIZZLE( blockDeterminants, 1, 1, 1, 1 );
+    const __m128 determinantC = LINEAR_SSE_SWIZZLE( blockDeterminants, 2, 2, 2, 2 );
+    const __m128 determinantD = LINEAR_SSE_SWIZZLE( blockDeterminants, 3, 3, 3, 3 );
+
+    const __m128 adjugateDC = _Matrix2x2AdjugateMultiplySSE( d, c );
+    const __m128 adjugateAB = _Matrix2x2AdjugateMultiplySSE( a, b );
+
+    // Adjugates of the blocks of the inverse, scaled by |M|.
+    __m128 x = _mm_sub_ps( _mm_mul_ps( determinantD, a ), _Matrix2x2MultiplySSE( b, adjugateDC ) );
+    __m128 w = _mm_sub_ps( _mm_mul_ps( determinantA, d ), _Matrix2x2MultiplySSE( c, adjugateAB ) );
+    __m128 y = _mm_sub_ps( _mm_mul_ps( determinantB, c ), _Matrix2x2MultiplyAdjugateSSE( d, adjugateAB ) );
+    __m128 z = _mm_sub_ps( _mm_mul_ps( determinantC, b ), _Matrix2x2MultiplyAdjugateSSE( a, adjugateDC ) );
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    __m128 trace = _mm_mul_ps( adjugateAB, LINEAR_SSE_SWIZZLE( adjugateDC, 0, 2, 1, 3 ) );
+    trace        = _mm_add_ps( trace, LINEAR_SSE_SWIZZLE( trace, 1, 0, 3, 2 ) );
+    trace        = _mm_add_ps( trace, LINEAR_SSE_SWIZZLE( trace, 2, 3, 0, 1 ) );
+
+    __m128 determinant = _mm_mul_ps( determinantA, determinantD );
+    determinant        = _mm_add_ps( determinant, _mm_mul_ps( determinantB, determinantC ) );
+    determinant        = _mm_sub_ps( determinant, trace );
+    if ( _IsNegligibleDeterminant( _mm_cvtss_f32( determinant ), i_matrix ) )
+    {
+        return false;
+    }
+
+    // Apply the signs of the 2x2 adjugate while dividing by the determinant.
+    const __m128 determinantReciprocal = _mm_div_ps( _mm_setr_ps( 1.0f, -1.0f, -1.0f, 1.0f ), determinant );
+    x                                  = _mm_mul_ps( x, determinantReciprocal );
+    y                                  = _mm_mul_ps( y, determinantReciprocal );
+    z                                  = _mm_mul_ps( z, determinantReciprocal );
+    w                                  = _mm_mul_ps( w, determinantReciprocal );
+
+    // Transpose the 2x2 adjugates while storing the rows.
+    _mm_storeu_ps( &o_inverse[ 0 ], LINEAR_SSE_SHUFFLE( x, y, 3, 1, 3, 1 ) );
+    _mm_storeu_ps( &o_inverse[ 4 ], LINEAR_SSE_SHUFFLE( x, y, 2, 0, 2, 0 ) );
+    _mm_storeu_ps( &o_inverse[ 8 ], LINEAR_SSE_SHUFFLE( z, w, 3, 1, 3, 1 ) );
+    _mm_storeu_ps( &o_inverse[ 12 ], LINEAR_SSE_SHUFFLE( z, w, 2, 0, 2, 0 ) );
+
+    return true;
+}
+
+#undef LINEAR_SSE_SWIZZLE
+#undef LINEAR_SSE_SHUFFLE
+
+#endif // defined( LINEAR_INVERSE_SSE )
+
+/// Compute the inverse of a 2x2, 3x3 or 4x4 matrix in closed-form, dispatching to the kernel of its size.
+///
+/// \return \p true if \p i_matrix is invertible.  \p false if its determinant is negligible, in which case
+/// \p o_inverse is un-modified.
+template < typename MatrixT >
+inline bool _MatrixInverseClosedForm( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    static_assert( _HasClosedFormInverse< MatrixT >() );
+
+    if constexpr ( MatrixT::RowCount() == 2 )
+    {
+        return _MatrixInverse2x2( i_matrix, o_inverse );
+    }
+    else if constexpr ( MatrixT::RowCount() == 3 )
+    {
+        return _MatrixInverse3x3( i_matrix, o_inverse );
+    }
+    else
+    {
+#if defined( LINEAR_INVERSE_SSE )
+        if constexpr ( std::is_same< MatrixT, Matrix< 4, 4, float > >::value )
+        {
+            return _MatrixInverse4x4SSE( i_matrix, o_inverse );
+        }
+#endif
+        return _MatrixInverse4x4( i_matrix, o_inverse );
+    }
+}
+
+LINEAR_NS_CLOSE
+
+#undef LINEAR_INVERSE_SSE
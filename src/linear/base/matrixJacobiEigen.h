@@ -0,0 +1,316 @@
+#pragma once
+
+/// \file matrixJacobiEigen.h
+///
+/// Cyclic Jacobi eigenvalue algorithm for symmetric matrices.
+///
+/// Each rotation \f$J\f$ in the \f$(p, q)\f$ plane zeroes the off-diagonal entry \f$a_{pq}\f$ via
+/// \f$A \leftarrow J^TAJ\f$, accumulating \f$V \leftarrow VJ\f$.  A sweep rotates every pair \f$p < q\f$ in
+/// row-cyclic order, and sweeps are repeated until the off-diagonal part vanishes, leaving the eigenvalues along the
+/// diagonal of \f$A\f$ and the eigenvectors in the columns of \f$V\f$.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+LINEAR_NS_OPEN
+
+/// Matrices of this size or smaller are diagonalized by a fixed number of fully unrolled sweeps, rather than
+/// sweeping until a tolerance is reached.
+constexpr size_t _JACOBI_UNROLL_SIZE = 4;
+
+/// The fixed number of sweeps performed for \p SIZE x \p SIZE matrices of \p ValueT.  Jacobi converges
+/// quadratically once the off-diagonal entries are small, so this suffices for full precision in practice.
+template < size_t SIZE, typename ValueT >
+constexpr size_t _JacobiSweepCount()
+{
+    return ( sizeof( ValueT ) > 4 ? 8 : 6 ) + ( SIZE > _JACOBI_UNROLL_SIZE ? SIZE / 2 : 0 );
+}
+
+/// Compute the cosine \p o_cos, sine \p o_sin and tangent \p o_tan of the Jacobi rotation zeroing \p i_apq,
+/// choosing the smaller rotation angle for stability.
+template < typename ValueT >
+inline void _JacobiRotation( const ValueT& i_app,
+                             const ValueT& i_aqq,
+                             const ValueT& i_apq,
+                             ValueT&       o_cos,
+                             ValueT&       o_sin,
+                             ValueT&       o_tan )
+{
+    if ( i_apq == 0 )
+    {
+        o_cos = 1;
+        o_sin = 0;
+        o_tan = 0;
+        return;
+    }
+
+    const ValueT theta = ( i_aqq - i_app ) / ( 2 * i_apq );
+    o_tan              = ( theta >= 0 ? 1 : -1 ) / ( std::abs( theta ) + std::sqrt( theta * theta + 1 ) );
+    o_cos              = 1 / std::sqrt( o_tan * o_tan + 1 );
+    o_sin              = o_tan * o_cos;
+}
+
+/// Apply the Jacobi rotation in the (\p i_p, \p i_q) plane to the symmetric matrix \p io_matrix, and accumulate it
+/// into the columns of \p io_eigenvectors.
+template < typename MatrixT >
+inline void _JacobiRotate( int i_p, int i_q, MatrixT& io_matrix, MatrixT& io_eigenvectors )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    const ValueT apq = io_matrix( i_p, i_q );
+    if ( apq == 0 )
+    {
+        return;
+    }
+
+    ValueT cosine, sine, tangent;
+    _JacobiRotation( io_matrix( i_p, i_p ), io_matrix( i_q, i_q ), apq, cosine, sine, tangent );
+
+    for ( int index = 0; index < MatrixT::RowCount(); ++index )
+    {
+        if ( index != i_p && index != i_q )
+        {
+            const ValueT akp        = io_matrix( index, i_p );
+            const ValueT akq        = io_matrix( index, i_q );
+            io_matrix( index, i_p ) = io_matrix( i_p, index ) = cosine * akp - sine * akq;
+            io_matrix( index, i_q ) = io_matrix( i_q, index ) = sine * akp + cosine * akq;
+        }
+
+        const ValueT vkp              = io_eigenvectors( index, i_p );
+        const ValueT vkq              = io_eigenvectors( index, i_q );
+        io_eigenvectors( index, i_p ) = cosine * vkp - sine * vkq;
+        io_eigenvectors( index, i_q ) = sine * vkp + cosine * vkq;
+    }
+
+    io_matrix( i_p, i_p ) -= tangent * apq;
+    io_matrix( i_q, i_q ) += tangent * apq;
+    io_matrix( i_p, i_q ) = io_matrix( i_q, i_p ) = 0;
+}
+
+/// Get the row of the \p i_pairIndex'th (p, q) pair of a \p SIZE x \p SIZE matrix, in row-cyclic order.
+template < size_t SIZE >
+constexpr int _JacobiPairRow( size_t i_pairIndex )
+{
+    size_t row = 0;
+    while ( i_pairIndex >= SIZE - 1 - row )
+    {
+        i_pairIndex -= SIZE - 1 - row;
+        ++row;
+    }
+    return row;
+}
+
+/// Get the column of the \p i_pairIndex'th (p, q) pair of a \p SIZE x \p SIZE matrix, in row-cyclic order.
+template < size_t SIZE >
+constexpr int _JacobiPairColumn( size_t i_pairIndex )
+{
+    size_t row = 0;
+    while ( i_pairIndex >= SIZE - 1 - row )
+    {
+        i_pairIndex -= SIZE - 1 - row;
+        ++row;
+    }
+    return row + 1 + i_pairIndex;
+}
+
+/// Perform a single sweep over every (p, q) pair, with the pair indices expanded at compile time.
+template < typename MatrixT, size_t... PAIR_INDICES >
+inline void _JacobiSweepUnrolled( MatrixT& io_matrix, MatrixT& io_eigenvectors, std::index_sequence< PAIR_INDICES... > )
+{
+    constexpr size_t SIZE = MatrixT::RowCount();
+    ( _JacobiRotate( _JacobiPairRow< SIZE >( PAIR_INDICES ),
+                     _JacobiPairColumn< SIZE >( PAIR_INDICES ),
+                     io_matrix,
+                     io_eigenvectors ),
+      ... );
+}
+
+/// Compute the squared Frobenius norm of the off-diagonal part of the symmetric matrix \p i_matrix.
+template < typename MatrixT >
+inline typename MatrixT::ValueType _OffDiagonalSquaredNorm( const MatrixT& i_matrix )
+{
+    typename MatrixT::ValueType squaredNorm = 0;
+    for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( int columnIndex = rowIndex + 1; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            squaredNorm += 2 * i_matrix( rowIndex, columnIndex ) * i_matrix( rowIndex, columnIndex );
+        }
+    }
+    return squaredNorm;
+}
+
+/// Diagonalize the symmetric matrix \p io_matrix in-place via cyclic Jacobi rotations, leaving its eigenvalues
+/// along the diagonal, and the corresponding eigenvectors in the columns of \p o_eigenvectors.
+///
+/// Matrices up to \ref _JACOBI_UNROLL_SIZE undergo a fixed number of unrolled sweeps.  Larger matrices are swept
+/// until the off-diagonal norm falls below machine precision relative to the norm of the matrix.
+///
+/// \return \p true if the off-diagonal part has converged.
+template < typename MatrixT >
+inline bool _MatrixSymmetricEigen( MatrixT& io_matrix, MatrixT& o_eigenvectors )
+{
+    using ValueT          = typename MatrixT::ValueType;
+    constexpr size_t SIZE = MatrixT::RowCount();
+
+    o_eigenvectors.SetIdentity();
+
+    ValueT squaredNorm = _OffDiagonalSquaredNorm( io_matrix );
+    for ( size_t index = 0; index < SIZE; ++index )
+    {
+        squaredNorm += io_matrix( index, index ) * io_matrix( index, index );
+    }
+
+    const ValueT epsilon   = std::numeric_limits< ValueT >::epsilon();
+    const ValueT threshold = epsilon * epsilon * squaredNorm;
+
+    if constexpr ( SIZE <= _JACOBI_UNROLL_SIZE )
+    {
+        for ( size_t sweepIndex = 0; sweepIndex < _JacobiSweepCount< SIZE, ValueT >(); ++sweepIndex )
+        {
+            _JacobiSweepUnrolled( io_matrix, o_eigenvectors, std::make_index_sequence< SIZE * ( SIZE - 1 ) / 2 >() );
+        }
+        return _OffDiagonalSquaredNorm( io_matrix ) <= threshold;
+    }
+    else
+    {
+        constexpr size_t maxSweepCount = 8 * _JacobiSweepCount< SIZE, ValueT >();
+        for ( size_t sweepIndex = 0; sweepIndex < maxSweepCount; ++sweepIndex )
+        {
+            if ( _OffDiagonalSquaredNorm( io_matrix ) <= threshold )
+            {
+                return true;
+            }
+
+            for ( size_t p = 0; p < SIZE - 1; ++p )
+            {
+                for ( size_t q = p + 1; q < SIZE; ++q )
+                {
+                    _JacobiRotate( p, q, io_matrix, o_eigenvectors );
+                }
+            }
+        }
+        return _OffDiagonalSquaredNorm( io_matrix ) <= threshold;
+    }
+}
+
+/// Diagonalize \p LANES symmetric \p SIZE x \p SIZE matrices at once via cyclic Jacobi rotations.
+///
+/// The matrices are interleaved, such that the \p LANES values of entry (row, column) are stored contiguously at
+/// offset <tt>( row * SIZE + column ) * LANES</tt>, in both \p io_matrixLanes and \p o_eigenvectorLanes.  Every
+/// operation is performed across all lanes, branch-free, so that the inner loops vectorize.  A fixed number of
+/// sweeps is performed.
+template < size_t SIZE, size_t LANES, typename ValueT >
+inline void _MatrixSymmetricEigenLanes( std::array< ValueT, SIZE * SIZE * LANES >& io_matrixLanes,
+                                        std::array< ValueT, SIZE * SIZE * LANES >& o_eigenvectorLanes )
+{
+    auto entry = [ & ]( std::array< ValueT, SIZE * SIZE * LANES >& io_lanes, size_t i_rowIndex, size_t i_columnIndex ) {
+        return io_lanes.data() + ( i_rowIndex * SIZE + i_columnIndex ) * LANES;
+    };
+
+    for ( size_t rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < SIZE; ++columnIndex )
+        {
+            std::fill_n( entry( o_eigenvectorLanes, rowIndex, columnIndex ), LANES, rowIndex == columnIndex ? 1 : 0 );
+        }
+    }
+
+    std::array< ValueT, LANES > cosines, sines, tangents;
+    for ( size_t sweepIndex = 0; sweepIndex < _JacobiSweepCount< SIZE, ValueT >(); ++sweepIndex )
+    {
+        for ( size_t p = 0; p < SIZE - 1; ++p )
+        {
+            for ( size_t q = p + 1; q < SIZE; ++q )
+            {
+                ValueT* app = entry( io_matrixLanes, p, p );
+                ValueT* aqq = entry( io_matrixLanes, q, q );
+                ValueT* apq = entry( io_matrixLanes, p, q );
+                ValueT* aqp = entry( io_matrixLanes, q, p );
+
+                for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                {
+                    // Lanes with a zero off-diagonal entry are rotated by the identity.
+                    const ValueT isZero  = apq[ laneIndex ] == 0;
+                    const ValueT theta   = ( aqq[ laneIndex ] - app[ laneIndex ] ) / ( 2 * apq[ laneIndex ] + isZero );
+                    const ValueT tangent = ( theta >= 0 ? 1 : -1 ) /
+                                           ( std::abs( theta ) + std::sqrt( theta * theta + 1 ) ) * ( 1 - isZero );
+                    tangents[ laneIndex ] = tangent;
+                    cosines[ laneIndex ]  = 1 / std::sqrt( tangent * tangent + 1 );
+                    sines[ laneIndex ]    = tangent * cosines[ laneIndex ];
+                }
+
+                for ( size_t index = 0; index < SIZE; ++index )
+                {
+                    if ( index != p && index != q )
+                    {
+                        ValueT* akp = entry( io_matrixLanes, index, p );
+                        ValueT* akq = entry( io_matrixLanes, index, q );
+                        ValueT* apk = entry( io_matrixLanes, p, index );
+                        ValueT* aqk = entry( io_matrixLanes, q, index );
+                        for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                        {
+                            const ValueT kp = akp[ laneIndex ];
+                            const ValueT kq = akq[ laneIndex ];
+                            akp[ laneIndex ] = apk[ laneIndex ] = cosines[ laneIndex ] * kp - sines[ laneIndex ] * kq;
+                            akq[ laneIndex ] = aqk[ laneIndex ] = sines[ laneIndex ] * kp + cosines[ laneIndex ] * kq;
+                        }
+                    }
+
+                    ValueT* vkp = entry( o_eigenvectorLanes, index, p );
+                    ValueT* vkq = entry( o_eigenvectorLanes, index, q );
+                    for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                    {
+                        const ValueT kp  = vkp[ laneIndex ];
+                        const ValueT kq  = vkq[ laneIndex ];
+                        vkp[ laneIndex ] = cosines[ laneIndex ] * kp - sines[ laneIndex ] * kq;
+                        vkq[ laneIndex ] = sines[ laneIndex ] * kp + cosines[ laneIndex ] * kq;
+                    }
+                }
+
+                for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                {
+                    app[ laneIndex ] -= tangents[ laneIndex ] * apq[ laneIndex ];
+                    aqq[ laneIndex ] += tangents[ laneIndex ] * apq[ laneIndex ];
+                    apq[ laneIndex ] = aqp[ laneIndex ] = 0;
+                }
+            }
+        }
+    }
+}
+
+/// Sort the eigenvalues in \p io_eigenvalues into ascending order, permuting the corresponding columns of
+/// \p io_eigenvectors alongside.
+template < typename EigenvaluesT, typename MatrixT >
+inline void _SortEigenpairs( EigenvaluesT& io_eigenvalues, MatrixT& io_eigenvectors )
+{
+    constexpr int SIZE = MatrixT::RowCount();
+    for ( int index = 0; index < SIZE - 1; ++index )
+    {
+        int minimumIndex = index;
+        for ( int candidateIndex = index + 1; candidateIndex < SIZE; ++candidateIndex )
+        {
+            if ( io_eigenvalues[ candidateIndex ] < io_eigenvalues[ minimumIndex ] )
+            {
+                minimumIndex = candidateIndex;
+            }
+        }
+
+        if ( minimumIndex != index )
+        {
+            std::swap( io_eigenvalues[ index ], io_eigenvalues[ minimumIndex ] );
+            for ( int rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+            {
+                std::swap( io_eigenvectors( rowIndex, index ), io_eigenvectors( rowIndex, minimumIndex ) );
+            }
+        }
+    }
+}
+
+LINEAR_NS_CLOSE
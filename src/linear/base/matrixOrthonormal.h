@@ -0,0 +1,39 @@
+#pragma once
+
+/// \file matrixOrthonormal.h
+///
+/// Implementation details for checking if a matrix is orthonormal.
+
+#include <linear/linear.h>
+
+#include <linear/base/almost.h>
+
+LINEAR_NS_OPEN
+
+/// Check if the columns of the leading \p SIZE x \p SIZE block of \p i_matrix are mutually orthogonal and of unit
+/// length, within the tolerance of \ref AlmostEqual.
+template < size_t SIZE, typename MatrixT >
+inline bool _MatrixIsOrthonormal( const MatrixT& i_matrix )
+{
+    static_assert( SIZE <= size_t( MatrixT::RowCount() ) && SIZE <= size_t( MatrixT::ColumnCount() ) );
+    using ValueT = typename MatrixT::ValueType;
+    for ( size_t columnA = 0; columnA < SIZE; ++columnA )
+    {
+        for ( size_t columnB = columnA; columnB < SIZE; ++columnB )
+        {
+            ValueT dotProduct = 0;
+            for ( size_t rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+            {
+                dotProduct += i_matrix( rowIndex, columnA ) * i_matrix( rowIndex, columnB );
+            }
+
+            if ( !AlmostEqual< ValueT >( dotProduct, columnA == columnB ? 1 : 0 ) )
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,122 @@
+#pragma once
+
+/// \file matrixPivotedQR.h
+///
+/// Column pivoted Householder QR implementation details.
+///
+/// At each step, the remaining column with the largest norm is exchanged into the pivot position before being
+/// reduced, such that the magnitudes of the diagonal entries of \f$R\f$ are non-increasing and the leading columns
+/// are the most independent.  The norms of the remaining columns bound the size of the not yet factored part of the
+/// matrix, so the factorization can stop as soon as they all fall below a tolerance, revealing the numerical rank.
+
+#include <linear/base/matrixHouseholder.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+LINEAR_NS_OPEN
+
+/// Compute the norm of column \p i_columnIndex of \p i_matrix, across the rows starting at \p i_rowBegin.
+template < typename MatrixT >
+inline typename MatrixT::ValueType _ColumnNorm( int i_columnIndex, int i_rowBegin, const MatrixT& i_matrix )
+{
+    typename MatrixT::ValueType squareSum = 0;
+    for ( int rowIndex = i_rowBegin; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        squareSum += i_matrix( rowIndex, i_columnIndex ) * i_matrix( rowIndex, i_columnIndex );
+    }
+    return std::sqrt( squareSum );
+}
+
+/// Factor \p io_matrix into \f$QR\f$ in-place via Householder reflections with column pivoting, stopping early
+/// once the norms of all the remaining columns are at or below \p i_tolerance.
+///
+/// The permuted columns of \p io_matrix are replaced by the leading rows of \f$R\f$ and the reflector vectors, as
+/// in \ref _MatrixHouseholderQR, for the factored columns only.  The original index of each factored column is
+/// stored in \p o_pivotColumns, in the order of factorization.
+///
+/// The column norms are down-dated after each step rather than re-computed, except when cancellation has
+/// eroded their accuracy.
+///
+/// \return the numerical rank, which is the number of factored columns.
+template < typename MatrixT, typename PivotColumnsT >
+inline int _MatrixPivotedQR( MatrixT&                           io_matrix,
+                             const typename MatrixT::ValueType& i_tolerance,
+                             PivotColumnsT&                     o_pivotColumns )
+{
+    static_assert( std::is_floating_point< typename MatrixT::ValueType >::value );
+    using ValueT                 = typename MatrixT::ValueType;
+    constexpr int COLUMN_COUNT   = MatrixT::ColumnCount();
+    constexpr int MAX_RANK       = std::min( MatrixT::RowCount(), MatrixT::ColumnCount() );
+    const ValueT  recomputeRatio = std::sqrt( std::numeric_limits< ValueT >::epsilon() );
+
+    // The current column of each original column, and the norms of the remaining part of each current column.
+    std::array< int, COLUMN_COUNT >    columnIndices;
+    std::array< ValueT, COLUMN_COUNT > norms;
+    std::array< ValueT, COLUMN_COUNT > recomputedNorms;
+    for ( int columnIndex = 0; columnIndex < COLUMN_COUNT; ++columnIndex )
+    {
+        columnIndices[ columnIndex ]   = columnIndex;
+        norms[ columnIndex ]           = _ColumnNorm( columnIndex, 0, io_matrix );
+        recomputedNorms[ columnIndex ] = norms[ columnIndex ];
+    }
+
+    for ( int stepIndex = 0; stepIndex < MAX_RANK; ++stepIndex )
+    {
+        const int pivotColumnIndex = std::max_element( norms.begin() + stepIndex, norms.end() ) - norms.begin();
+        if ( norms[ pivotColumnIndex ] <= i_tolerance )
+        {
+            return stepIndex;
+        }
+
+        // Exchange the pivot column into place.
+        if ( pivotColumnIndex != stepIndex )
+        {
+            for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+            {
+                std::swap( io_matrix( rowIndex, stepIndex ), io_matrix( rowIndex, pivotColumnIndex ) );
+            }
+            std::swap( columnIndices[ stepIndex ], columnIndices[ pivotColumnIndex ] );
+            std::swap( norms[ stepIndex ], norms[ pivotColumnIndex ] );
+            std::swap( recomputedNorms[ stepIndex ], recomputedNorms[ pivotColumnIndex ] );
+        }
+        o_pivotColumns[ stepIndex ] = columnIndices[ stepIndex ];
+
+        // Reduce the pivot column, and apply the reflector to the remaining columns.
+        const ValueT tau = _HouseholderReflector( stepIndex, io_matrix );
+        _ApplyHouseholderReflector( io_matrix, stepIndex, tau, stepIndex + 1, COLUMN_COUNT, io_matrix );
+
+        // Remove the entry of row stepIndex from the norm of each remaining column.
+        for ( int columnIndex = stepIndex + 1; columnIndex < COLUMN_COUNT; ++columnIndex )
+        {
+            if ( norms[ columnIndex ] == 0 )
+            {
+                continue;
+            }
+
+            ValueT ratio         = std::abs( io_matrix( stepIndex, columnIndex ) ) / norms[ columnIndex ];
+            ValueT remainingRate = std::max< ValueT >( 0, ( 1 - ratio ) * ( 1 + ratio ) );
+            ValueT accuracy      = norms[ columnIndex ] / recomputedNorms[ columnIndex ];
+            if ( remainingRate * accuracy * accuracy <= recomputeRatio )
+            {
+                norms[ columnIndex ]           = _ColumnNorm( columnIndex, stepIndex + 1, io_matrix );
+                recomputedNorms[ columnIndex ] = norms[ columnIndex ];
+            }
+            else
+            {
+                norms[ columnIndex ] *= std::sqrt( remainingRate );
+            }
+        }
+    }
+
+    return MAX_RANK;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,134 @@
+#pragma once
+
+/// \file matrixQRUpdate.h
+///
+/// Updating and down-dating the triangular factor of a QR decomposition, as rows are added to and removed from
+/// the decomposed matrix.
+///
+/// Only the upper triangular factor \f$R\f$ is maintained, in the leading \p i_size rows and columns of a larger
+/// matrix.  As \f$R^TR = A^TA\f$, it fully describes the least squares problem without \f$Q\f$, whose size would
+/// grow with the number of rows.
+
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// Update the triangular factor \p io_factor for the new row \p io_row of the decomposed matrix, by rotating the
+/// row into the factor via Givens rotations, in \f$O(n^2)\f$.
+///
+/// The rotations zero out \p io_row, which is used as scratch memory.
+template < typename MatrixT >
+inline void _QRAppendRow( int i_size, MatrixT& io_factor, typename MatrixT::ValueType* io_row )
+{
+    using ValueT = typename MatrixT::ValueType;
+    for ( int pivotIndex = 0; pivotIndex < i_size; ++pivotIndex )
+    {
+        if ( io_row[ pivotIndex ] == 0 )
+        {
+            continue;
+        }
+
+        // Rotate the entry of the row into the diagonal, keeping the diagonal non-negative.
+        const ValueT diagonal = io_factor( pivotIndex, pivotIndex );
+        const ValueT radius   = std::hypot( diagonal, io_row[ pivotIndex ] );
+        _RotateRows( diagonal / radius,
+                     -io_row[ pivotIndex ] / radius,
+                     i_size - pivotIndex,
+                     &io_factor( pivotIndex, pivotIndex ),
+                     io_row + pivotIndex );
+    }
+}
+
+/// Down-date the triangular factor of an augmented matrix \f$[A \, b]\f$ for the removal of the row
+/// \f$[a^T \, \beta]\f$, in \f$O(n^2)\f$, following the LINPACK \p dchdd algorithm.
+///
+/// \p io_factor holds the augmented factor
+/// \f[
+/// \begin{bmatrix} R & z \\ 0 & \rho \end{bmatrix}
+/// \f]
+/// in its leading \p i_size + 1 rows and columns, where \f$R\f$ has \p i_size columns, and \p i_row holds the
+/// \p i_size + 1 entries of the removed row.
+///
+/// The row is expressed as \f$a = R^Tp\f$, then the rotations which would annihilate \f$p\f$ against a unit entry
+/// are applied to \f$R\f$ and \f$z\f$ in reverse.  The residual norm \f$\rho\f$ is not a pivot of the solve, as it
+/// vanishes for consistent data, but is down-dated separately as \f$\sqrt{\rho^2 - \zeta^2}\f$, where \f$\zeta\f$
+/// is the part of \f$\beta\f$ rotated out of \f$z\f$.
+///
+/// \return \p false if the down-dated \f$R\f$ would not be positive definite, either as the row was not part of
+/// the decomposed matrix or due to rounding errors, in which case \p io_factor is left untouched.
+template < int MAX_SIZE, typename MatrixT >
+inline bool _QRRemoveRow( int i_size, const typename MatrixT::ValueType* i_row, MatrixT& io_factor )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    // Solve R^T * p = a.
+    std::array< ValueT, MAX_SIZE > solution;
+    ValueT                         solutionSquareSum = 0;
+    for ( int index = 0; index < i_size; ++index )
+    {
+        ValueT value = i_row[ index ];
+        for ( int previousIndex = 0; previousIndex < index; ++previousIndex )
+        {
+            value -= io_factor( previousIndex, index ) * solution[ previousIndex ];
+        }
+
+        if ( io_factor( index, index ) == 0 )
+        {
+            return false;
+        }
+        solution[ index ] = value / io_factor( index, index );
+        solutionSquareSum += solution[ index ] * solution[ index ];
+    }
+
+    if ( solutionSquareSum >= 1 )
+    {
+        return false;
+    }
+
+    // The rotations which annihilate p, from the last entry up.
+    std::array< ValueT, MAX_SIZE > cosines;
+    std::array< ValueT, MAX_SIZE > sines;
+    ValueT                         alpha = std::sqrt( 1 - solutionSquareSum );
+    for ( int index = i_size - 1; index >= 0; --index )
+    {
+        const ValueT radius = std::hypot( alpha, solution[ index ] );
+        cosines[ index ]    = alpha / radius;
+        sines[ index ]      = solution[ index ] / radius;
+        alpha               = radius;
+    }
+
+    // Apply them to R, in reverse, carrying the rotated out row upwards.
+    std::array< ValueT, MAX_SIZE > carried{};
+    for ( int rowIndex = i_size - 1; rowIndex >= 0; --rowIndex )
+    {
+        _RotateRows( cosines[ rowIndex ],
+                     sines[ rowIndex ],
+                     i_size - rowIndex,
+                     &io_factor( rowIndex, rowIndex ),
+                     carried.data() + rowIndex );
+    }
+
+    // Then to z, from the first entry down, rotating out beta.
+    ValueT zeta = i_row[ i_size ];
+    for ( int rowIndex = 0; rowIndex < i_size; ++rowIndex )
+    {
+        ValueT& entry = io_factor( rowIndex, i_size );
+        entry         = ( entry - sines[ rowIndex ] * zeta ) / cosines[ rowIndex ];
+        zeta          = cosines[ rowIndex ] * zeta - sines[ rowIndex ] * entry;
+    }
+
+    // Rounding errors may leave zeta beyond a vanishing rho, whose down-date is then zero.
+    const ValueT residualNorm   = std::abs( io_factor( i_size, i_size ) );
+    const ValueT ratio          = std::abs( zeta ) / residualNorm;
+    io_factor( i_size, i_size ) = ratio < 1 ? residualNorm * std::sqrt( ( 1 - ratio ) * ( 1 + ratio ) ) : 0;
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
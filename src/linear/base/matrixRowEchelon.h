@@ -17,46 +17,46 @@
 
 LINEAR_NS_OPEN
 
-/// Compute the row echelon form of \p i_matrix, storing the kinds of columns revealed throughout the
+/// Reduce \p io_matrix into its row echelon form in-place, storing the kinds of columns revealed throughout the
 /// reduction process so that it can accelerate a calling operation like _MatrixReducedRowEchelonForm,
 /// or to find out the rank of a matrix.
-template < typename MatrixT >
-inline MatrixT _MatrixRowEchelonForm(
-    const MatrixT&                                                                                            i_matrix,
-    MatrixEntryArray< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), typename MatrixT::ValueType >& o_pivots )
+///
+/// \p o_eliminationFactors is the scratch record of a single elimination step.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT, typename MatrixT, typename EliminationRecordT, typename PivotsT >
+inline void _MatrixRowEchelonForm( MatrixT& io_matrix, EliminationRecordT& o_eliminationFactors, PivotsT& o_pivots )
 {
-    // Working matrix copy.
-    MatrixT matrix = i_matrix;
-
-    // Record elimination operations.
-    MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+    static_assert( _ExchangesRows< PivotT >(),
+                   "NoPivot cannot reveal the rank, as a column may require a row exchange to produce its pivot." );
+    o_eliminationFactors.Reset();
+    o_pivots.Reset();
 
     // Elimination, reducing matrix A into U (upper triangular).
     int pivotRowIndex = 0, pivotColIndex = 0;
     while ( pivotRowIndex < MatrixT::RowCount() && pivotColIndex < MatrixT::ColumnCount() )
     {
-        const typename MatrixT::ValueType& pivotValue = matrix( pivotRowIndex, pivotColIndex );
-        if ( matrix( pivotRowIndex, pivotColIndex ) == 0 )
+        // Select a pivot, exchanging rows if required.
+        int exchangedRow = _FindAndPerformRowExchange< PivotT >( pivotRowIndex, pivotColIndex, io_matrix );
+        if ( exchangedRow == -1 )
         {
-            // Try to find a row below with a non-zero pivot to exchange.
-            int exchangedRow = _FindAndPerformRowExchange( pivotRowIndex, pivotColIndex, matrix );
-            if ( exchangedRow == -1 )
-            {
-                // Only increment column index and continue with elimination.
-                pivotColIndex += 1;
-                continue;
-            }
+            // Only increment column index and continue with elimination.
+            pivotColIndex += 1;
+            continue;
         }
 
+        const typename MatrixT::ValueType& pivotValue = io_matrix( pivotRowIndex, pivotColIndex );
+
         // Record the elimination on matrix, then replay onto o_inverse.
         _RecordElimination( pivotRowIndex,
                             pivotColIndex,
                             IntRange( pivotRowIndex + 1, MatrixT::RowCount() ) /* rowRange */,
-                            IntRange( pivotColIndex, MatrixT::ColumnCount() ) /* columnRange */,
-                            eliminationFactors,
-                            matrix );
+                            pivotColIndex /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
 
-        eliminationFactors.Reset();
+        o_eliminationFactors.Reset();
 
         // This column has a pivot.
         o_pivots.Append( pivotRowIndex, pivotColIndex, pivotValue );
@@ -65,26 +65,42 @@ inline MatrixT _MatrixRowEchelonForm(
         pivotRowIndex += 1;
         pivotColIndex += 1;
     }
-
-    return matrix;
 }
 
-/// Compute the reduced row echelon form of \p i_matrix.
-template < typename MatrixT >
-inline MatrixT _MatrixReducedRowEchelonForm( const MatrixT& i_matrix )
+/// Compute the row echelon form of \p i_matrix, storing the kinds of columns revealed throughout the
+/// reduction process so that it can accelerate a calling operation like _MatrixReducedRowEchelonForm,
+/// or to find out the rank of a matrix.
+template < typename PivotT, typename MatrixT >
+inline typename MatrixT::MatrixType _MatrixRowEchelonForm(
+    const MatrixT&                                                                                            i_matrix,
+    MatrixEntryArray< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), typename MatrixT::ValueType >& o_pivots )
 {
-    using PivotsT =
-        MatrixEntryArray< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), typename MatrixT::ValueType >;
-    PivotsT pivots;
-    MatrixT rowEchelonForm = _MatrixRowEchelonForm( i_matrix, pivots );
+    // Working matrix copy.
+    typename MatrixT::MatrixType matrix = i_matrix;
 
     // Record elimination operations.
-    MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+    MatrixEliminationRecord< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+
+    _MatrixRowEchelonForm< PivotT >( matrix, eliminationFactors, o_pivots );
+    return matrix;
+}
+
+/// Reduce \p io_matrix into its reduced row echelon form in-place.
+///
+/// \p o_eliminationFactors is the scratch record of a single elimination step, and \p o_pivots the scratch
+/// array of pivots.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT, typename MatrixT, typename EliminationRecordT, typename PivotsT >
+inline void
+_MatrixReducedRowEchelonForm( MatrixT& io_matrix, EliminationRecordT& o_eliminationFactors, PivotsT& o_pivots )
+{
+    _MatrixRowEchelonForm< PivotT >( io_matrix, o_eliminationFactors, o_pivots );
 
     // The
-    for ( int entryIndex : IntRange( pivots.Size() - 1, -1 ) )
+    for ( int entryIndex : IntRange( o_pivots.Size() - 1, -1 ) )
     {
-        const typename PivotsT::Entry& entry      = pivots[ entryIndex ];
+        const typename PivotsT::Entry& entry      = o_pivots[ entryIndex ];
         const MatrixIndex&             pivotIndex = std::get< 0 >( entry );
 
         // Perform elimination, by subtracting the pivot's row from the rows above, to
@@ -92,22 +108,38 @@ inline MatrixT _MatrixReducedRowEchelonForm( const MatrixT& i_matrix )
         _RecordElimination( pivotIndex.Row(),
                             pivotIndex.Column(),
                             IntRange( pivotIndex.Row() - 1, -1 ) /* rowRange */,
-                            IntRange( MatrixT::ColumnCount() - 1, -1 ) /* columnRange */,
-                            eliminationFactors,
-                            rowEchelonForm );
+                            0 /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
 
         // Divide the pivot row by the pivot value, so that it becomes 1.
         const typename PivotsT::ValueType& pivotValue        = std::get< 1 >( entry );
         typename MatrixT::ValueType        pivotValueInverse = 1.0 / pivotValue;
         for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); columnIndex++ )
         {
-            rowEchelonForm( pivotIndex.Row(), columnIndex ) *= pivotValueInverse;
+            io_matrix( pivotIndex.Row(), columnIndex ) *= pivotValueInverse;
         }
 
-        eliminationFactors.Reset();
+        o_eliminationFactors.Reset();
     }
+}
 
-    return rowEchelonForm;
+/// Compute the reduced row echelon form of \p i_matrix.
+template < typename PivotT, typename MatrixT >
+inline typename MatrixT::MatrixType _MatrixReducedRowEchelonForm( const MatrixT& i_matrix )
+{
+    // Working matrix copy.
+    typename MatrixT::MatrixType matrix = i_matrix;
+
+    // Record elimination operations.
+    MatrixEliminationRecord< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+
+    // Pivots discovered throughout elimination.
+    MatrixEntryArray< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), typename MatrixT::ValueType > pivots;
+
+    _MatrixReducedRowEchelonForm< PivotT >( matrix, eliminationFactors, pivots );
+    return matrix;
 }
 
 LINEAR_NS_CLOSE
@@ -0,0 +1,182 @@
+#pragma once
+
+/// \file matrixSVD.h
+///
+/// One-sided Jacobi singular value decomposition implementation details.
+///
+/// The one-sided (Hestenes) Jacobi method applies plane rotations \f$J\f$ on the right of \f$A\f$, each making a
+/// pair of columns orthogonal, until all columns are mutually orthogonal:
+/// \f[
+/// AV = U\Sigma
+/// \f]
+/// The column lengths are the singular values, and the accumulated rotations form \f$V\f$.  It is as accurate as
+/// the data allows, even for tiny singular values.
+///
+/// Tall matrices are first reduced to their square triangular factor \f$R\f$ through a QR decomposition, so that
+/// every rotation touches \f$n\f$ rather than \f$m\f$ entries.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/multiply.h>
+#include <linear/qrDecomposition.h>
+#include <linear/transpose.h>
+
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixGramSchmidt.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+LINEAR_NS_OPEN
+
+/// Mutually orthogonalize the \em rows of \p io_rows via one-sided Jacobi rotations, accumulating the rotations
+/// into the rows of \p io_vRows when \p COMPUTE_VECTORS is set.
+///
+/// Operating on rows, rather than columns, keeps every dot product and rotation over contiguous entries.
+///
+/// \return \p true if a sweep completed without any rotation, thus the rows are orthogonal to machine precision.
+template < bool COMPUTE_VECTORS, typename MatrixT, typename VMatrixT >
+inline bool _MatrixOneSidedJacobi( MatrixT& io_rows, VMatrixT& io_vRows )
+{
+    using ValueT = typename MatrixT::ValueType;
+
+    constexpr int    ROWS          = MatrixT::RowCount();
+    constexpr int    COLS          = MatrixT::ColumnCount();
+    constexpr size_t maxSweepCount = 64;
+
+    const ValueT tolerance = std::sqrt( ValueT( COLS ) ) * std::numeric_limits< ValueT >::epsilon();
+    for ( size_t sweepIndex = 0; sweepIndex < maxSweepCount; ++sweepIndex )
+    {
+        bool hasRotated = false;
+        for ( int p = 0; p < ROWS - 1; ++p )
+        {
+            for ( int q = p + 1; q < ROWS; ++q )
+            {
+                ValueT*      rowP  = &io_rows( p, 0 );
+                ValueT*      rowQ  = &io_rows( q, 0 );
+                const ValueT alpha = _DotProduct( rowP, rowP, COLS );
+                const ValueT beta  = _DotProduct( rowQ, rowQ, COLS );
+                const ValueT gamma = _DotProduct( rowP, rowQ, COLS );
+                if ( std::abs( gamma ) <= tolerance * std::sqrt( alpha * beta ) )
+                {
+                    continue;
+                }
+
+                const ValueT zeta    = ( beta - alpha ) / ( 2 * gamma );
+                const ValueT tangent = ( zeta >= 0 ? 1 : -1 ) / ( std::abs( zeta ) + std::sqrt( zeta * zeta + 1 ) );
+                const ValueT cosine  = 1 / std::sqrt( tangent * tangent + 1 );
+                const ValueT sine    = tangent * cosine;
+
+                _RotateRows( cosine, sine, COLS, rowP, rowQ );
+                if constexpr ( COMPUTE_VECTORS )
+                {
+                    _RotateRows( cosine, sine, VMatrixT::ColumnCount(), &io_vRows( p, 0 ), &io_vRows( q, 0 ) );
+                }
+                hasRotated = true;
+            }
+        }
+
+        if ( !hasRotated )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// Compute the singular value decomposition of the tall (or square) matrix \p i_matrix.
+///
+/// \param i_matrix the matrix to decompose, with at least as many rows as columns.
+/// \param o_singularValues the singular values, in descending order.
+/// \param o_u the thin left singular vectors, as columns.  Only written if \p COMPUTE_VECTORS is set.
+/// \param o_v the right singular vectors, as columns.  Only written if \p COMPUTE_VECTORS is set.
+///
+/// \return \p true if the Jacobi iteration converged.
+template < bool COMPUTE_VECTORS, typename MatrixT, typename SingularValuesT, typename VMatrixT >
+inline bool _MatrixSVD( const MatrixT&                i_matrix,
+                        SingularValuesT&              o_singularValues,
+                        typename MatrixT::MatrixType& o_u,
+                        VMatrixT&                     o_v )
+{
+    static_assert( MatrixT::RowCount() >= MatrixT::ColumnCount() );
+
+    using ValueT         = typename MatrixT::ValueType;
+    constexpr int SIZE   = MatrixT::ColumnCount();
+    using SquareMatrixT  = Matrix< SIZE, SIZE, ValueT >;
+    constexpr bool IS_QR = MatrixT::RowCount() > SIZE;
+
+    // The rows of the transposed (triangular factor of the) matrix are orthogonalized.
+    QRDecomposition< typename MatrixT::MatrixType > qr;
+    SquareMatrixT                                   rows;
+    if constexpr ( IS_QR )
+    {
+        qr.Factorize( i_matrix );
+        rows = Transpose( qr.R() );
+    }
+    else
+    {
+        rows = Transpose( i_matrix );
+    }
+
+    SquareMatrixT vRows        = SquareMatrixT::Identity();
+    const bool    hasConverged = _MatrixOneSidedJacobi< COMPUTE_VECTORS >( rows, vRows );
+
+    // The singular values are the lengths of the orthogonalized rows.
+    for ( int index = 0; index < SIZE; ++index )
+    {
+        o_singularValues[ index ] = std::sqrt( _DotProduct( &rows( index, 0 ), &rows( index, 0 ), SIZE ) );
+    }
+
+    // Sort into descending order.
+    for ( int index = 0; index < SIZE - 1; ++index )
+    {
+        int maximumIndex = index;
+        for ( int candidateIndex = index + 1; candidateIndex < SIZE; ++candidateIndex )
+        {
+            if ( o_singularValues[ candidateIndex ] > o_singularValues[ maximumIndex ] )
+            {
+                maximumIndex = candidateIndex;
+            }
+        }
+
+        if ( maximumIndex != index && COMPUTE_VECTORS )
+        {
+            std::swap_ranges( &rows( index, 0 ), &rows( index, 0 ) + SIZE, &rows( maximumIndex, 0 ) );
+            std::swap_ranges( &vRows( index, 0 ), &vRows( index, 0 ) + SIZE, &vRows( maximumIndex, 0 ) );
+        }
+        std::swap( o_singularValues[ index ], o_singularValues[ maximumIndex ] );
+    }
+
+    if constexpr ( COMPUTE_VECTORS )
+    {
+        // Normalize the rows into left singular vectors.  Those of zero singular values are undetermined, and are
+        // completed into an orthonormal basis.
+        int rank = 0;
+        while ( rank < SIZE && o_singularValues[ rank ] > std::numeric_limits< ValueT >::min() )
+        {
+            const ValueT lengthReciprocal = 1 / o_singularValues[ rank ];
+            for ( int columnIndex = 0; columnIndex < SIZE; ++columnIndex )
+            {
+                rows( rank, columnIndex ) *= lengthReciprocal;
+            }
+            ++rank;
+        }
+        _CompleteOrthonormalRows( rank, rows );
+
+        if constexpr ( IS_QR )
+        {
+            o_u = Multiply( qr.Q(), Transpose( rows ) );
+        }
+        else
+        {
+            o_u = Transpose( rows );
+        }
+        o_v = Transpose( vRows );
+    }
+
+    return hasConverged;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,82 @@
+#pragma once
+
+/// \file matrixSolve.h
+///
+/// Linear system solve implementation details.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/intRange.h>
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixTriangularSolve.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+LINEAR_NS_OPEN
+
+/// Solve the linear system \f$AX = B\f$ via Gaussian elimination on the augmented system, followed by back
+/// substitution, using caller-provided scratch memory.
+///
+/// \p io_matrix is the working matrix, which is initially \f$A\f$, and is reduced to upper triangular form
+/// throughout elimination.  \p io_solution is initially \f$B\f$, and assumes the solution \f$X\f$.
+/// \p o_eliminationFactors is the scratch record of a single elimination step.
+///
+/// If elimination fails due to \f$A\f$ being \em singular, the value of \p io_solution will be un-defined.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT, typename MatrixT, typename SolutionT, typename EliminationRecordT >
+inline bool _MatrixSolve( MatrixT& io_matrix, SolutionT& io_solution, EliminationRecordT& o_eliminationFactors )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    static_assert( MatrixT::RowCount() == SolutionT::RowCount() );
+
+    o_eliminationFactors.Reset();
+
+    // Gauss step: E*A -> U, E*B -> C
+    for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
+    {
+        // Select a pivot, exchanging rows if required.
+        if constexpr ( _ExchangesRows< PivotT >() )
+        {
+            int exchangedRow = _FindAndPerformRowExchange< PivotT >( pivotIndex, pivotIndex, io_matrix );
+            if ( exchangedRow == -1 )
+            {
+                // No pivot in this column, thus the system has no unique solution.
+                return false;
+            }
+            else if ( exchangedRow != pivotIndex )
+            {
+                RowExchange( pivotIndex, exchangedRow, io_solution );
+            }
+        }
+        else if ( io_matrix( pivotIndex, pivotIndex ) == 0 )
+        {
+            return false;
+        }
+
+        // Record the elimination on io_matrix, then replay onto io_solution.  The co-efficients of the pivot
+        // column below the pivot are never read again, thus are left un-modified.
+        _RecordElimination( pivotIndex,
+                            pivotIndex,
+                            IntRange( pivotIndex + 1, MatrixT::RowCount() ) /* rowRange */,
+                            pivotIndex + 1 /* columnBegin */,
+                            MatrixT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_matrix );
+        _ReplayElimination( pivotIndex,
+                            0 /* columnBegin */,
+                            SolutionT::ColumnCount() /* columnEnd */,
+                            o_eliminationFactors,
+                            io_solution );
+
+        // Reset the cache for the next iteration.
+        o_eliminationFactors.Reset();
+    }
+
+    // Back substitution: U^-1*C -> X
+    _UpperTriangularSolve( io_matrix, io_solution );
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,230 @@
+#pragma once
+
+/// \file matrixTiledFactorization.h
+///
+/// Task-parallel tiled LU and Cholesky decompositions.
+///
+/// The matrix is partitioned into square tiles of \p TILE_SIZE, and each factorization step is expressed as tasks
+/// operating on tiles: factoring a panel (or diagonal tile), triangular solves against it, and the matrix
+/// multiplication updating each trailing tile.  The tasks are connected into a \ref TaskGraph according to the
+/// tiles they read and write, and executed on a \ref TaskPool, such that the updates of later steps overlap with
+/// the factorization of earlier panels.
+///
+/// Every tile is written by a chain of tasks ordered through dependencies, so the results are identical to the
+/// serial blocked factorizations, regardless of the number of threads.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/taskPool.h>
+
+#include <linear/base/matrixBlockedLU.h>
+#include <linear/base/matrixCholesky.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+LINEAR_NS_OPEN
+
+/// Compute the LU decomposition of \p io_matrix in-place, as a graph of tile tasks executed on \p io_pool.
+///
+/// The layout of the factors, and the recorded row exchanges, are those of \ref _MatrixBlockedLU.
+///
+/// \return \p true if every pivot is non-zero, thus the matrix is non-singular.
+template < size_t TILE_SIZE, typename PivotT, typename MatrixT, typename PivotRowsT >
+inline bool _MatrixTiledLU( MatrixT& io_matrix, PivotRowsT& o_pivotRows, int& o_rowExchanges, TaskPool& io_pool )
+{
+    static_assert( TILE_SIZE > 0 );
+    constexpr int                  SIZE       = MatrixT::RowCount();
+    constexpr int                  TILE       = TILE_SIZE;
+    constexpr int                  TILE_COUNT = ( SIZE + TILE - 1 ) / TILE;
+    constexpr TaskGraph::TaskIndex NO_TASK    = TaskGraph::TaskIndex( -1 );
+
+    auto tileBegin = []( int i_tileIndex ) { return i_tileIndex * TILE; };
+    auto tileEnd   = []( int i_tileIndex ) {
+        return i_tileIndex + 1 < TILE_COUNT ? ( i_tileIndex + 1 ) * TILE : SIZE;
+    };
+
+    // Results of each panel, written by its own task.
+    std::vector< char > panelIsNonSingular( TILE_COUNT, 1 );
+    std::vector< int >  panelRowExchanges( TILE_COUNT, 0 );
+
+    TaskGraph graph;
+
+    // The most recent task writing each tile, in row-major order of tiles.  Each task writing a tile depends on the
+    // previous writer, and becomes the most recent.
+    std::vector< TaskGraph::TaskIndex > lastWriter( TILE_COUNT * TILE_COUNT, NO_TASK );
+    auto dependOnLastWriter = [ & ]( int i_rowTile, int i_columnTile, TaskGraph::TaskIndex i_task ) {
+        TaskGraph::TaskIndex& writer = lastWriter[ i_rowTile * TILE_COUNT + i_columnTile ];
+        if ( writer != NO_TASK )
+        {
+            graph.AddDependency( writer, i_task );
+        }
+        writer = i_task;
+    };
+
+    for ( int stepTile = 0; stepTile < TILE_COUNT; ++stepTile )
+    {
+        // Factor the panel, exchanging rows within the panel only.
+        const TaskGraph::TaskIndex panelTask = graph.AddTask( [ &, stepTile ]() {
+            panelIsNonSingular[ stepTile ] = _FactorLUPanel< PivotT >( tileBegin( stepTile ),
+                                                                       tileEnd( stepTile ),
+                                                                       io_matrix,
+                                                                       o_pivotRows,
+                                                                       panelRowExchanges[ stepTile ] );
+        } );
+        for ( int rowTile = stepTile; rowTile < TILE_COUNT; ++rowTile )
+        {
+            dependOnLastWriter( rowTile, stepTile, panelTask );
+        }
+
+        for ( int columnTile = stepTile + 1; columnTile < TILE_COUNT; ++columnTile )
+        {
+            // Apply the row exchanges of the panel to this column of tiles, then U12 = L11^-1 * A12.
+            const TaskGraph::TaskIndex solveTask = graph.AddTask( [ &, stepTile, columnTile ]() {
+                _ApplyRowExchanges( tileBegin( stepTile ),
+                                    tileEnd( stepTile ),
+                                    o_pivotRows,
+                                    tileBegin( columnTile ),
+                                    tileEnd( columnTile ),
+                                    io_matrix );
+                _SolveLUBlockRow( tileBegin( stepTile ),
+                                  tileEnd( stepTile ),
+                                  tileBegin( columnTile ),
+                                  tileEnd( columnTile ),
+                                  io_matrix );
+            } );
+            graph.AddDependency( panelTask, solveTask );
+            for ( int rowTile = stepTile; rowTile < TILE_COUNT; ++rowTile )
+            {
+                dependOnLastWriter( rowTile, columnTile, solveTask );
+            }
+
+            // A22 -= L21 * U12, one tile at a time.
+            for ( int rowTile = stepTile + 1; rowTile < TILE_COUNT; ++rowTile )
+            {
+                const TaskGraph::TaskIndex updateTask = graph.AddTask( [ &, stepTile, rowTile, columnTile ]() {
+                    _MultiplySubtract( tileEnd( rowTile ) - tileBegin( rowTile ) /* rowCount */,
+                                       tileEnd( columnTile ) - tileBegin( columnTile ) /* columnCount */,
+                                       tileEnd( stepTile ) - tileBegin( stepTile ) /* depth */,
+                                       &io_matrix( tileBegin( rowTile ), tileBegin( stepTile ) ),
+                                       SIZE,
+                                       &io_matrix( tileBegin( stepTile ), tileBegin( columnTile ) ),
+                                       SIZE,
+                                       &io_matrix( tileBegin( rowTile ), tileBegin( columnTile ) ),
+                                       SIZE );
+                } );
+                dependOnLastWriter( rowTile, columnTile, updateTask );
+            }
+        }
+    }
+
+    io_pool.Run( graph );
+
+    // Apply the row exchanges of each panel to the factors of L computed before it.
+    o_rowExchanges     = 0;
+    bool isNonSingular = true;
+    for ( int stepTile = 0; stepTile < TILE_COUNT; ++stepTile )
+    {
+        _ApplyRowExchanges( tileBegin( stepTile ),
+                            tileEnd( stepTile ),
+                            o_pivotRows,
+                            0 /* columnBegin */,
+                            tileBegin( stepTile ) /* columnEnd */,
+                            io_matrix );
+        o_rowExchanges += panelRowExchanges[ stepTile ];
+        isNonSingular &= panelIsNonSingular[ stepTile ] != 0;
+    }
+
+    return isNonSingular;
+}
+
+/// Factor the symmetric matrix \p io_matrix into \f$LL^T\f$ in-place, as a graph of tile tasks executed on
+/// \p io_pool.
+///
+/// Only the lower triangular part of \p io_matrix is read, which is replaced by \f$L\f$.
+///
+/// \return \p true if the matrix is positive definite.  \p false otherwise, in which case the value of
+/// \p io_matrix is un-defined.
+template < size_t TILE_SIZE, typename MatrixT >
+inline bool _MatrixTiledCholesky( MatrixT& io_matrix, TaskPool& io_pool )
+{
+    static_assert( TILE_SIZE > 0 );
+    constexpr int                  SIZE       = MatrixT::RowCount();
+    constexpr int                  TILE       = TILE_SIZE;
+    constexpr int                  TILE_COUNT = ( SIZE + TILE - 1 ) / TILE;
+    constexpr TaskGraph::TaskIndex NO_TASK    = TaskGraph::TaskIndex( -1 );
+
+    auto tileBegin = []( int i_tileIndex ) { return i_tileIndex * TILE; };
+    auto tileEnd   = []( int i_tileIndex ) {
+        return i_tileIndex + 1 < TILE_COUNT ? ( i_tileIndex + 1 ) * TILE : SIZE;
+    };
+
+    std::atomic< bool > isPositiveDefinite{true};
+
+    TaskGraph graph;
+
+    // The most recent task writing each tile of the lower triangle, as for the LU decomposition, and the task
+    // solving each tile of the current column of tiles.
+    std::vector< TaskGraph::TaskIndex > lastWriter( TILE_COUNT * TILE_COUNT, NO_TASK );
+    std::vector< TaskGraph::TaskIndex > solveTasks( TILE_COUNT, NO_TASK );
+    auto dependOnLastWriter = [ & ]( int i_rowTile, int i_columnTile, TaskGraph::TaskIndex i_task ) {
+        TaskGraph::TaskIndex& writer = lastWriter[ i_rowTile * TILE_COUNT + i_columnTile ];
+        if ( writer != NO_TASK )
+        {
+            graph.AddDependency( writer, i_task );
+        }
+        writer = i_task;
+    };
+
+    for ( int stepTile = 0; stepTile < TILE_COUNT; ++stepTile )
+    {
+        // Factor the diagonal tile.
+        const TaskGraph::TaskIndex factorTask = graph.AddTask( [ &, stepTile ]() {
+            if ( !_FactorCholeskyBlock( tileBegin( stepTile ), tileEnd( stepTile ), io_matrix ) )
+            {
+                isPositiveDefinite = false;
+            }
+        } );
+        dependOnLastWriter( stepTile, stepTile, factorTask );
+
+        // L21 = A21 * L11^-T, one tile at a time.
+        for ( int rowTile = stepTile + 1; rowTile < TILE_COUNT; ++rowTile )
+        {
+            solveTasks[ rowTile ] = graph.AddTask( [ &, stepTile, rowTile ]() {
+                _SolveCholeskyBlock(
+                    tileBegin( stepTile ), tileEnd( stepTile ), tileBegin( rowTile ), tileEnd( rowTile ), io_matrix );
+            } );
+            graph.AddDependency( factorTask, solveTasks[ rowTile ] );
+            dependOnLastWriter( rowTile, stepTile, solveTasks[ rowTile ] );
+        }
+
+        // A22 -= L21 * L21^T, over the tiles of the lower triangle.
+        for ( int columnTile = stepTile + 1; columnTile < TILE_COUNT; ++columnTile )
+        {
+            for ( int rowTile = columnTile; rowTile < TILE_COUNT; ++rowTile )
+            {
+                const TaskGraph::TaskIndex updateTask = graph.AddTask( [ &, stepTile, rowTile, columnTile ]() {
+                    _UpdateCholeskyBlock( tileBegin( stepTile ),
+                                          tileEnd( stepTile ),
+                                          tileBegin( rowTile ),
+                                          tileEnd( rowTile ),
+                                          tileBegin( columnTile ),
+                                          tileEnd( columnTile ),
+                                          io_matrix );
+                } );
+                graph.AddDependency( solveTasks[ rowTile ], updateTask );
+                if ( columnTile != rowTile )
+                {
+                    graph.AddDependency( solveTasks[ columnTile ], updateTask );
+                }
+                dependOnLastWriter( rowTile, columnTile, updateTask );
+            }
+        }
+    }
+
+    io_pool.Run( graph );
+    return isPositiveDefinite;
+}
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,113 @@
+#pragma once
+
+/// \file matrixTriangularSolve.h
+///
+/// Triangular system solve implementation details.
+///
+/// The solutions are computed in-place, one pivot row at a time, subtracting multiples of the solved row from
+/// the remaining rows so that all the right-hand side columns are updated through contiguous memory.
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+LINEAR_NS_OPEN
+
+/// Solve \f$LY = B\f$ in-place, where \f$L\f$ is the lower triangular part of \p i_factor.
+///
+/// \p io_solution is initially \f$B\f$, and assumes the solution \f$Y\f$.
+///
+/// \tparam UNIT_DIAGONAL whether the diagonal of \f$L\f$ is implicitly 1.
+template < bool UNIT_DIAGONAL, typename MatrixT, typename SolutionT >
+inline void _LowerTriangularSolve( const MatrixT& i_factor, SolutionT& io_solution )
+{
+    for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
+    {
+        typename SolutionT::ValueType* solutionRow = &io_solution( pivotIndex, 0 );
+        if constexpr ( !UNIT_DIAGONAL )
+        {
+            const typename MatrixT::ValueType pivotValueReciprocal = 1.0 / i_factor( pivotIndex, pivotIndex );
+            for ( int columnIndex = 0; columnIndex < SolutionT::ColumnCount(); ++columnIndex )
+            {
+                solutionRow[ columnIndex ] *= pivotValueReciprocal;
+            }
+        }
+
+        for ( int rowIndex = pivotIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            _EliminateRow( solutionRow,
+                           i_factor( rowIndex, pivotIndex ),
+                           0 /* columnBegin */,
+                           SolutionT::ColumnCount() /* columnEnd */,
+                           &io_solution( rowIndex, 0 ) );
+        }
+    }
+}
+
+/// Solve \f$L^TX = Y\f$ in-place, where \f$L\f$ is the lower triangular part of \p i_factor.
+///
+/// \p io_solution is initially \f$Y\f$, and assumes the solution \f$X\f$.
+///
+/// \tparam UNIT_DIAGONAL whether the diagonal of \f$L\f$ is implicitly 1.
+template < bool UNIT_DIAGONAL, typename MatrixT, typename SolutionT >
+inline void _LowerTriangularTransposeSolve( const MatrixT& i_factor, SolutionT& io_solution )
+{
+    for ( int pivotIndex = MatrixT::RowCount() - 1; pivotIndex >= 0; --pivotIndex )
+    {
+        typename SolutionT::ValueType* solutionRow = &io_solution( pivotIndex, 0 );
+        if constexpr ( !UNIT_DIAGONAL )
+        {
+            const typename MatrixT::ValueType pivotValueReciprocal = 1.0 / i_factor( pivotIndex, pivotIndex );
+            for ( int columnIndex = 0; columnIndex < SolutionT::ColumnCount(); ++columnIndex )
+            {
+                solutionRow[ columnIndex ] *= pivotValueReciprocal;
+            }
+        }
+
+        // Row pivotIndex of L is column pivotIndex of L^T, which is contiguous.
+        const typename MatrixT::ValueType* factorRow = &i_factor( pivotIndex, 0 );
+        for ( int rowIndex = 0; rowIndex < pivotIndex; ++rowIndex )
+        {
+            _EliminateRow( solutionRow,
+                           factorRow[ rowIndex ],
+                           0 /* columnBegin */,
+                           SolutionT::ColumnCount() /* columnEnd */,
+                           &io_solution( rowIndex, 0 ) );
+        }
+    }
+}
+
+/// Solve \f$UX = Y\f$ in-place, where \f$U\f$ is the upper triangular part of the leading square block of
+/// \p i_factor.
+///
+/// \p io_solution is initially \f$Y\f$, and assumes the solution \f$X\f$.
+template < typename MatrixT, typename SolutionT >
+inline void _UpperTriangularSolve( const MatrixT& i_factor, SolutionT& io_solution )
+{
+    static_assert( MatrixT::ColumnCount() == SolutionT::RowCount() );
+
+    for ( int pivotIndex = SolutionT::RowCount() - 1; pivotIndex >= 0; --pivotIndex )
+    {
+        // Divide the pivot row of the solution by the pivot value.
+        typename SolutionT::ValueType*    solutionRow          = &io_solution( pivotIndex, 0 );
+        const typename MatrixT::ValueType pivotValueReciprocal = 1.0 / i_factor( pivotIndex, pivotIndex );
+        for ( int columnIndex = 0; columnIndex < SolutionT::ColumnCount(); ++columnIndex )
+        {
+            solutionRow[ columnIndex ] *= pivotValueReciprocal;
+        }
+
+        // Subtract the solved row from the rows above.
+        for ( int rowIndex = 0; rowIndex < pivotIndex; ++rowIndex )
+        {
+            _EliminateRow( solutionRow,
+                           i_factor( rowIndex, pivotIndex ),
+                           0 /* columnBegin */,
+                           SolutionT::ColumnCount() /* columnEnd */,
+                           &io_solution( rowIndex, 0 ) );
+        }
+    }
+}
+
+LINEAR_NS_CLOSE
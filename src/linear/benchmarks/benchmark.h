@@ -0,0 +1,63 @@
+#pragma once
+
+/// \file benchmarks/benchmark.h
+///
+/// Minimal timing utilities shared by the benchmark programs.
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+/// Time \p i_iterations invocations of \p i_function, and print the average duration per invocation.
+///
+/// \return the average duration per invocation, in nanoseconds.
+template < typename FunctionT >
+double Benchmark( const char* i_name, size_t i_iterations, FunctionT&& i_function )
+{
+    auto start = std::chrono::steady_clock::now();
+    for ( size_t iteration = 0; iteration < i_iterations; ++iteration )
+    {
+        i_function( iteration );
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double nanoseconds = std::chrono::duration< double, std::nano >( end - start ).count() / i_iterations;
+    printf( "%-48s %12.2f ns\n", i_name, nanoseconds );
+    return nanoseconds;
+}
+
+/// Generate \p i_count matrices of random entries, uniformly distributed in [-1, 1].
+template < typename MatrixT >
+std::vector< MatrixT > RandomMatrices( size_t i_count )
+{
+    std::mt19937                                                   generator( 0 );
+    std::uniform_real_distribution< typename MatrixT::ValueType > distribution( -1, 1 );
+
+    std::vector< MatrixT > matrices( i_count );
+    for ( MatrixT& matrix : matrices )
+    {
+        for ( int entryIndex = 0; entryIndex < MatrixT::EntryCount(); ++entryIndex )
+        {
+            matrix[ entryIndex ] = distribution( generator );
+        }
+    }
+    return matrices;
+}
+
+/// Generate \p i_count random, diagonally dominant (thus invertible) matrices.
+template < typename MatrixT >
+std::vector< MatrixT > RandomInvertibleMatrices( size_t i_count )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    std::vector< MatrixT > matrices = RandomMatrices< MatrixT >( i_count );
+    for ( MatrixT& matrix : matrices )
+    {
+        for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            matrix( rowIndex, rowIndex ) += MatrixT::ColumnCount();
+        }
+    }
+    return matrices;
+}
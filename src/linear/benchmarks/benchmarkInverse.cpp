@@ -0,0 +1,41 @@
+/// \file benchmarks/benchmarkInverse.cpp
+///
+/// Compares general Gauss-Jordan elimination against the closed-form kernels used by Inverse for small matrices.
+
+#include "benchmark.h"
+
+#include <linear/inverse.h>
+
+template < typename MatrixT >
+void BenchmarkInverse( const char* i_gaussJordanName, const char* i_inverseName )
+{
+    constexpr size_t       matrixCount = 1024;
+    constexpr size_t       iterations  = 1 << 22;
+    std::vector< MatrixT > matrices    = RandomInvertibleMatrices< MatrixT >( matrixCount );
+
+    // Accumulated to keep the computations from being optimized away.
+    MatrixT inverse;
+    double  checksum = 0;
+
+    double gaussJordan = Benchmark( i_gaussJordanName, iterations, [ & ]( size_t i_iteration ) {
+        linear::_MatrixInverse< linear::ZeroPivot >( matrices[ i_iteration % matrixCount ], inverse );
+        checksum += inverse[ 0 ];
+    } );
+
+    double closedForm = Benchmark( i_inverseName, iterations, [ & ]( size_t i_iteration ) {
+        linear::Inverse( matrices[ i_iteration % matrixCount ], inverse );
+        checksum += inverse[ 0 ];
+    } );
+
+    printf( "%-48s %12.2fx (checksum %g)\n\n", "speedup", gaussJordan / closedForm, checksum );
+}
+
+int main()
+{
+    BenchmarkInverse< linear::Matrix< 2, 2, float > >( "Gauss-Jordan 2x2 float", "Inverse 2x2 float" );
+    BenchmarkInverse< linear::Matrix< 3, 3, float > >( "Gauss-Jordan 3x3 float", "Inverse 3x3 float" );
+    BenchmarkInverse< linear::Matrix< 3, 3, double > >( "Gauss-Jordan 3x3 double", "Inverse 3x3 double" );
+    BenchmarkInverse< linear::Matrix< 4, 4, float > >( "Gauss-Jordan 4x4 float", "Inverse 4x4 float" );
+    BenchmarkInverse< linear::Matrix< 4, 4, double > >( "Gauss-Jordan 4x4 double", "Inverse 4x4 double" );
+    return 0;
+}
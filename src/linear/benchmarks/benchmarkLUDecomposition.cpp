@@ -0,0 +1,77 @@
+/// \file benchmarks/benchmarkLUDecomposition.cpp
+///
+/// Compares the unblocked LU decomposition, which eliminates one pivot at a time, against the blocked
+/// decomposition, whose trailing updates run as cache-blocked matrix multiplications.  Also compares Gauss-Jordan
+/// inversion against inversion through the blocked LU decomposition.
+
+#include "benchmark.h"
+
+#include <linear/inverse.h>
+#include <linear/luDecomposition.h>
+
+#include <memory>
+
+template < typename MatrixT >
+void BenchmarkLUDecomposition( const char* i_unblockedName,
+                               const char* i_blockedName,
+                               const char* i_gaussJordanName,
+                               const char* i_inverseName,
+                               size_t      i_iterations )
+{
+    constexpr size_t       matrixCount = 4;
+    std::vector< MatrixT > matrices    = RandomInvertibleMatrices< MatrixT >( matrixCount );
+
+    // Large matrices are kept off the stack.
+    using UnblockedT = linear::LUDecomposition< MatrixT, linear::PartialPivot, MatrixT::RowCount() >;
+    using BlockedT   = linear::LUDecomposition< MatrixT, linear::PartialPivot >;
+    auto unblocked   = std::make_unique< UnblockedT >();
+    auto blocked     = std::make_unique< BlockedT >();
+    auto inverse     = std::make_unique< MatrixT >();
+
+    // Accumulated to keep the computations from being optimized away.
+    double checksum = 0;
+
+    double unblockedTime = Benchmark( i_unblockedName, i_iterations, [ & ]( size_t i_iteration ) {
+        unblocked->Factorize( matrices[ i_iteration % matrixCount ] );
+        checksum += unblocked->Determinant();
+    } );
+
+    double blockedTime = Benchmark( i_blockedName, i_iterations, [ & ]( size_t i_iteration ) {
+        blocked->Factorize( matrices[ i_iteration % matrixCount ] );
+        checksum += blocked->Determinant();
+    } );
+
+    printf( "%-48s %12.2fx\n", "speedup", unblockedTime / blockedTime );
+
+    double gaussJordanTime = Benchmark( i_gaussJordanName, i_iterations, [ & ]( size_t i_iteration ) {
+        linear::_MatrixInverse< linear::PartialPivot >( matrices[ i_iteration % matrixCount ], *inverse );
+        checksum += ( *inverse )[ 0 ];
+    } );
+
+    double inverseTime = Benchmark( i_inverseName, i_iterations, [ & ]( size_t i_iteration ) {
+        linear::Inverse< linear::PartialPivot >( matrices[ i_iteration % matrixCount ], *inverse );
+        checksum += ( *inverse )[ 0 ];
+    } );
+
+    printf( "%-48s %12.2fx (checksum %g)\n\n", "speedup", gaussJordanTime / inverseTime, checksum );
+}
+
+int main()
+{
+    BenchmarkLUDecomposition< linear::Matrix< 32, 32, double > >( "Unblocked LU 32x32 double",
+                                                                  "Blocked LU 32x32 double",
+                                                                  "Gauss-Jordan 32x32 double",
+                                                                  "Inverse 32x32 double",
+                                                                  1 << 12 );
+    BenchmarkLUDecomposition< linear::Matrix< 64, 64, double > >( "Unblocked LU 64x64 double",
+                                                                  "Blocked LU 64x64 double",
+                                                                  "Gauss-Jordan 64x64 double",
+                                                                  "Inverse 64x64 double",
+                                                                  1 << 9 );
+    BenchmarkLUDecomposition< linear::Matrix< 128, 128, double > >( "Unblocked LU 128x128 double",
+                                                                    "Blocked LU 128x128 double",
+                                                                    "Gauss-Jordan 128x128 double",
+                                                                    "Inverse 128x128 double",
+                                                                    1 << 6 );
+    return 0;
+}
@@ -0,0 +1,73 @@
+/// \file benchmarks/benchmarkParallelFactorization.cpp
+///
+/// Measures the scaling of the tiled LU and Cholesky decompositions with the number of threads of the task pool,
+/// against the serial factorizations.
+
+#include "benchmark.h"
+
+#include <linear/choleskyDecomposition.h>
+#include <linear/luDecomposition.h>
+#include <linear/parallelFactorization.h>
+#include <linear/taskPool.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+template < typename MatrixT >
+void BenchmarkParallelFactorization( const char* i_sizeName, size_t i_iterations )
+{
+    // The lower triangle of a diagonally dominant matrix with a positive diagonal is also that of a symmetric
+    // positive definite matrix, so the same matrix is used for both decompositions.
+    constexpr size_t       matrixCount = 2;
+    std::vector< MatrixT > matrices    = RandomInvertibleMatrices< MatrixT >( matrixCount );
+
+    // Large matrices are kept off the stack.
+    auto lu       = std::make_unique< linear::LUDecomposition< MatrixT, linear::PartialPivot > >();
+    auto cholesky = std::make_unique< linear::CholeskyDecomposition< MatrixT > >();
+
+    // Accumulated to keep the computations from being optimized away.
+    double checksum = 0;
+    char   name[ 64 ];
+
+    snprintf( name, sizeof( name ), "Serial LU %s", i_sizeName );
+    double serialLUTime = Benchmark( name, i_iterations, [ & ]( size_t i_iteration ) {
+        lu->Factorize( matrices[ i_iteration % matrixCount ] );
+        checksum += lu->IsNonSingular();
+    } );
+
+    snprintf( name, sizeof( name ), "Serial Cholesky %s", i_sizeName );
+    double serialCholeskyTime = Benchmark( name, i_iterations, [ & ]( size_t i_iteration ) {
+        cholesky->Factorize( matrices[ i_iteration % matrixCount ] );
+        checksum += cholesky->IsPositiveDefinite();
+    } );
+
+    const size_t maxThreadCount = std::max( std::thread::hardware_concurrency(), 1u );
+    for ( size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2 )
+    {
+        linear::TaskPool pool( threadCount );
+
+        snprintf( name, sizeof( name ), "Tiled LU %s, %zu threads", i_sizeName, threadCount );
+        double luTime = Benchmark( name, i_iterations, [ & ]( size_t i_iteration ) {
+            linear::ParallelFactorize( *lu, matrices[ i_iteration % matrixCount ], pool );
+            checksum += lu->IsNonSingular();
+        } );
+        printf( "%-48s %12.2fx\n", "speedup", serialLUTime / luTime );
+
+        snprintf( name, sizeof( name ), "Tiled Cholesky %s, %zu threads", i_sizeName, threadCount );
+        double choleskyTime = Benchmark( name, i_iterations, [ & ]( size_t i_iteration ) {
+            linear::ParallelFactorize( *cholesky, matrices[ i_iteration % matrixCount ], pool );
+            checksum += cholesky->IsPositiveDefinite();
+        } );
+        printf( "%-48s %12.2fx\n", "speedup", serialCholeskyTime / choleskyTime );
+    }
+
+    printf( "(checksum %g)\n\n", checksum );
+}
+
+int main()
+{
+    BenchmarkParallelFactorization< linear::Matrix< 512, 512, double > >( "512x512 double", 1 << 4 );
+    BenchmarkParallelFactorization< linear::Matrix< 1024, 1024, double > >( "1024x1024 double", 1 << 2 );
+    return 0;
+}
@@ -0,0 +1,42 @@
+/// \file benchmarks/benchmarkProjection.cpp
+///
+/// Compares projecting many vectors onto the same subspace through \ref linear::Projection, which re-factors the
+/// subspace for every vector, against a \ref linear::Projector factored once.
+
+#include "benchmark.h"
+
+#include <linear/projection.h>
+
+template < typename MatrixT >
+void BenchmarkProjection( const char* i_projectionName, const char* i_projectorName, size_t i_iterations )
+{
+    using VectorT = linear::Matrix< MatrixT::RowCount(), 1, typename MatrixT::ValueType >;
+
+    constexpr size_t       vectorCount = 256;
+    const MatrixT          subspace    = RandomMatrices< MatrixT >( 1 )[ 0 ];
+    std::vector< VectorT > vectors     = RandomMatrices< VectorT >( vectorCount );
+    std::vector< VectorT > projections( vectorCount );
+
+    double projectionTime = Benchmark( i_projectionName, i_iterations, [ & ]( size_t /* i_iteration */ ) {
+        for ( size_t index = 0; index < vectorCount; ++index )
+        {
+            projections[ index ] = linear::Projection( vectors[ index ], subspace );
+        }
+    } );
+
+    double projectorTime = Benchmark( i_projectorName, i_iterations, [ & ]( size_t /* i_iteration */ ) {
+        linear::Projector< MatrixT > projector( subspace );
+        projector.Project( vectors.data(), vectorCount, projections.data() );
+    } );
+
+    printf( "%-48s %12.2fx (checksum %g)\n\n", "speedup", projectionTime / projectorTime, projections[ 0 ][ 0 ] );
+}
+
+int main()
+{
+    BenchmarkProjection< linear::Matrix< 8, 3, double > >(
+        "Projection 256 vectors 8x3 double", "Projector 256 vectors 8x3 double", 1 << 10 );
+    BenchmarkProjection< linear::Matrix< 32, 8, double > >(
+        "Projection 256 vectors 32x8 double", "Projector 256 vectors 32x8 double", 1 << 6 );
+    return 0;
+}
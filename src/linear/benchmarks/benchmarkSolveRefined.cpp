@@ -0,0 +1,59 @@
+/// \file benchmarks/benchmarkSolveRefined.cpp
+///
+/// Compares solving a double precision system through a double precision LU decomposition, against
+/// \ref linear::SolveRefined, which factors in single precision and refines the solution in double precision.
+
+#include "benchmark.h"
+
+#include <linear/luDecomposition.h>
+#include <linear/solve.h>
+
+#include <memory>
+
+template < typename MatrixT >
+void BenchmarkSolveRefined( const char* i_solveName, const char* i_refinedName, size_t i_iterations )
+{
+    using VectorT = linear::Matrix< MatrixT::RowCount(), 1, double >;
+
+    constexpr size_t       matrixCount = 4;
+    std::vector< MatrixT > matrices    = RandomInvertibleMatrices< MatrixT >( matrixCount );
+    std::vector< VectorT > rhs         = RandomMatrices< VectorT >( matrixCount );
+
+    // Large matrices are kept off the stack.
+    using LUDecompositionT = linear::LUDecomposition< MatrixT, linear::PartialPivot >;
+    auto    decomposition  = std::make_unique< LUDecompositionT >();
+    VectorT solution;
+
+    // Accumulated to keep the computations from being optimized away.
+    double checksum       = 0;
+    int    iterationCount = 0;
+
+    double solveTime = Benchmark( i_solveName, i_iterations, [ & ]( size_t i_iteration ) {
+        decomposition->Factorize( matrices[ i_iteration % matrixCount ] );
+        decomposition->Solve( rhs[ i_iteration % matrixCount ], solution );
+        checksum += solution[ 0 ];
+    } );
+
+    double refinedTime = Benchmark( i_refinedName, i_iterations, [ & ]( size_t i_iteration ) {
+        linear::SolveRefined(
+            matrices[ i_iteration % matrixCount ], rhs[ i_iteration % matrixCount ], solution, iterationCount );
+        checksum += solution[ 0 ];
+    } );
+
+    printf( "%-48s %12.2fx (%d refinement iterations, checksum %g)\n\n",
+            "speedup",
+            solveTime / refinedTime,
+            iterationCount,
+            checksum );
+}
+
+int main()
+{
+    BenchmarkSolveRefined< linear::Matrix< 128, 128, double > >(
+        "LU solve 128x128 double", "SolveRefined 128x128 double", 1 << 8 );
+    BenchmarkSolveRefined< linear::Matrix< 256, 256, double > >(
+        "LU solve 256x256 double", "SolveRefined 256x256 double", 1 << 5 );
+    BenchmarkSolveRefined< linear::Matrix< 512, 512, double > >(
+        "LU solve 512x512 double", "SolveRefined 512x512 double", 1 << 3 );
+    return 0;
+}
@@ -0,0 +1,43 @@
+/// \file benchmarks/benchmarkSymmetricEigen.cpp
+///
+/// Compares per-matrix Jacobi eigendecomposition of 3x3 symmetric matrices against the interleaved batch kernel.
+
+#include "benchmark.h"
+
+#include <linear/symmetricEigenDecomposition.h>
+#include <linear/transpose.h>
+
+int main()
+{
+    using MatrixT = linear::Matrix< 3, 3, float >;
+
+    constexpr size_t       matrixCount = 1 << 16;
+    constexpr size_t       iterations  = 16;
+    std::vector< MatrixT > matrices    = RandomInvertibleMatrices< MatrixT >( matrixCount );
+    for ( MatrixT& matrix : matrices )
+    {
+        matrix = linear::Matrix< 3, 3, float >( matrix ) + linear::Transpose( matrix );
+    }
+
+    std::vector< linear::Matrix< 3, 1, float > > eigenvalues( matrixCount );
+    std::vector< MatrixT >                       eigenvectors( matrixCount );
+
+    // Accumulated to keep the computations from being optimized away.
+    double checksum = 0;
+
+    double single = Benchmark( "SymmetricEigenDecomposition 3x3 float", iterations, [ & ]( size_t ) {
+        for ( size_t matrixIndex = 0; matrixIndex < matrixCount; ++matrixIndex )
+        {
+            linear::SymmetricEigenDecomposition< MatrixT > eigen( matrices[ matrixIndex ] );
+            checksum += eigen.Eigenvalues()[ 0 ];
+        }
+    } );
+
+    double batch = Benchmark( "SymmetricEigen batch 3x3 float", iterations, [ & ]( size_t ) {
+        linear::SymmetricEigen( matrices.data(), matrixCount, eigenvalues.data(), eigenvectors.data() );
+        checksum += eigenvalues[ 0 ][ 0 ];
+    } );
+
+    printf( "%-48s %12.2fx (checksum %g)\n", "speedup", single / batch, checksum );
+    return 0;
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+/// \file biCGStab.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Bi-conjugate gradient stabilized method (BiCGSTAB).
+///
+/// Iteratively solves \f$Ax = b\f$ for a general non-singular \f$A\f$.  Each iteration combines a bi-conjugate
+/// gradient step with a one dimensional minimization of the residual, which smooths the otherwise irregular
+/// convergence of the former, for the cost of two products with \f$A\f$ and without needing \f$A^T\f$.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/preconditioner.h>
+
+#include <linear/base/iterativeSolver.h>
+#include <linear/base/matrixElimination.h>
+
+LINEAR_NS_OPEN
+
+/// \class BiCGStab
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Solver of general non-singular systems via the BiCGSTAB method:
+/// \code{.cpp}
+/// linear::BiCGStab< linear::Matrix< 64, 1 > > solver;
+/// linear::Matrix< 64, 1 > solution; // The initial guess.
+/// bool converged = solver.Solve( advection, rhs, solution );
+/// \endcode
+///
+/// The operator \f$A\f$ is any type providing \p Apply( x, y ) to compute \f$y = Ax\f$, or a \ref Matrix.  The
+/// workspace vectors are members of the solver, so a solver may be re-used across solves without allocations.
+///
+/// \tparam VectorT the column vector type of the solution and right-hand side.
+template < typename VectorT >
+class BiCGStab final : public _IterativeSolver< VectorT >
+{
+public:
+    using typename _IterativeSolver< VectorT >::ValueType;
+
+    /// Solve \f$Ax = b\f$, starting from the initial guess \p io_solution.
+    ///
+    /// \param i_operator the operator \f$A\f$.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if the method broke down, in which case \p io_solution holds the last iterate.
+    template < typename OperatorT >
+    inline bool Solve( const OperatorT& i_operator, const VectorT& i_rhs, VectorT& io_solution )
+    {
+        return Solve( i_operator, IdentityPreconditioner< VectorT >(), i_rhs, io_solution );
+    }
+
+    /// Solve \f$Ax = b\f$ preconditioned by \f$M\f$, starting from the initial guess \p io_solution.
+    ///
+    /// The system is preconditioned on the right, as \f$AM^{-1}y = b\f$ with \f$x = M^{-1}y\f$, such that the
+    /// residual whose norm is tested remains the residual of the original system.
+    ///
+    /// \param i_operator the operator \f$A\f$.
+    /// \param i_preconditioner the preconditioner \f$M\f$, such as \ref IncompleteLUPreconditioner.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if the method broke down, in which case \p io_solution holds the last iterate.
+    template < typename OperatorT, typename PreconditionerT >
+    bool Solve( const OperatorT&       i_operator,
+                const PreconditionerT& i_preconditioner,
+                const VectorT&         i_rhs,
+                VectorT&               io_solution )
+    {
+        constexpr int   N         = VectorT::RowCount();
+        const ValueType threshold = this->_Begin( i_rhs, io_solution );
+        if ( this->_Residual( i_operator, i_rhs, io_solution, m_residual ) <= threshold )
+        {
+            return true;
+        }
+
+        // The residuals are bi-orthogonalized against the Krylov subspace of the initial residual.
+        m_shadowResidual = m_residual;
+        m_direction      = m_residual;
+        ValueType rho    = _DotProduct( &m_shadowResidual[ 0 ], &m_residual[ 0 ], N );
+        while ( this->m_iterationCount < this->m_maxIterations )
+        {
+            // Bi-conjugate gradient step.
+            _ApplyOperator( i_preconditioner, m_direction, m_preconditioned );
+            _ApplyOperator( i_operator, m_preconditioned, m_directionProduct );
+            const ValueType projection = _DotProduct( &m_shadowResidual[ 0 ], &m_directionProduct[ 0 ], N );
+            if ( projection == 0 )
+            {
+                return false;
+            }
+
+            const ValueType alpha = rho / projection;
+            _EliminateRow( &m_preconditioned[ 0 ], -alpha, 0, N, &io_solution[ 0 ] );
+            _EliminateRow( &m_directionProduct[ 0 ], alpha, 0, N, &m_residual[ 0 ] );
+            this->m_iterationCount++;
+
+            this->m_residualNorm = _VectorNorm( m_residual );
+            if ( this->m_residualNorm <= threshold )
+            {
+                return true;
+            }
+
+            // Minimize the residual along its own (preconditioned) image.
+            _ApplyOperator( i_preconditioner, m_residual, m_preconditioned );
+            _ApplyOperator( i_operator, m_preconditioned, m_residualProduct );
+            const ValueType productSquare = _DotProduct( &m_residualProduct[ 0 ], &m_residualProduct[ 0 ], N );
+            if ( productSquare == 0 )
+            {
+                return false;
+            }
+
+            const ValueType omega = _DotProduct( &m_residualProduct[ 0 ], &m_residual[ 0 ], N ) / productSquare;
+            _EliminateRow( &m_preconditioned[ 0 ], -omega, 0, N, &io_solution[ 0 ] );
+            _EliminateRow( &m_residualProduct[ 0 ], omega, 0, N, &m_residual[ 0 ] );
+
+            this->m_residualNorm = _VectorNorm( m_residual );
+            if ( this->m_residualNorm <= threshold )
+            {
+                return true;
+            }
+
+            const ValueType nextRho = _DotProduct( &m_shadowResidual[ 0 ], &m_residual[ 0 ], N );
+            if ( nextRho == 0 || omega == 0 )
+            {
+                return false;
+            }
+
+            // p = r + beta * (p - omega * A * M^-1 * p)
+            const ValueType beta = ( nextRho / rho ) * ( alpha / omega );
+            for ( int index = 0; index < N; ++index )
+            {
+                m_direction[ index ] =
+                    m_residual[ index ] + beta * ( m_direction[ index ] - omega * m_directionProduct[ index ] );
+            }
+            rho = nextRho;
+        }
+
+        return false;
+    }
+
+private:
+    VectorT m_residual;
+    VectorT m_preconditioned;
+    VectorT m_shadowResidual;
+    VectorT m_direction;
+    VectorT m_directionProduct;
+    VectorT m_residualProduct;
+};
+
+LINEAR_NS_CLOSE
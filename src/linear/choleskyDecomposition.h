@@ -0,0 +1,386 @@
+#pragma once
+
+/// \file choleskyDecomposition.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Cholesky decomposition.
+///
+/// A symmetric positive definite matrix \f$A\f$ is factored into
+/// \f[
+/// A = LL^T
+/// \f]
+/// where \f$L\f$ is lower triangular with positive diagonal entries.
+///
+/// The square-root free variant factors a symmetric matrix \f$A\f$ into
+/// \f[
+/// A = LDL^T
+/// \f]
+/// where \f$L\f$ is lower triangular with 1's down its diagonal, and \f$D\f$ is diagonal.  This variant only
+/// requires the matrix to be symmetric with non-zero pivots, rather than positive definite.
+///
+/// Exploiting symmetry, both factorizations cost roughly half the operations of the LU decomposition.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixCholesky.h>
+
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+struct _ParallelFactorization;
+
+/// \class CholeskyDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The \f$LL^T\f$ decomposition of a symmetric positive definite matrix, computed once and reusable across
+/// many operations.
+///
+/// Only the lower triangular part of the decomposed matrix is read.
+///
+/// \tparam MatrixT the type of the symmetric matrix to decompose.
+template < typename MatrixT >
+class CholeskyDecomposition final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix, and its factors.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    CholeskyDecomposition() = default;
+
+    /// Construct the Cholesky decomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    explicit CholeskyDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    ///
+    /// \return \p true if \p i_matrix is positive definite.  \p false otherwise, in which case the decomposition
+    /// is not usable.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        m_factor             = i_matrix;
+        m_isPositiveDefinite = _MatrixCholesky( m_factor );
+        return m_isPositiveDefinite;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the decomposed matrix is positive definite, thus the decomposition is usable.
+    ///
+    /// \return \p true if the decomposed matrix is positive definite.
+    inline bool IsPositiveDefinite() const
+    {
+        return m_isPositiveDefinite;
+    }
+
+    /// Solve the linear system \f$AX = B\f$ for \f$X\f$, where \f$A\f$ is the decomposed matrix.
+    ///
+    /// \p i_rhs may be a single column vector \f$b\f$, or a matrix \f$B\f$ whose columns are many right-hand sides.
+    /// \p i_rhs and \p o_solution may refer to the same matrix.
+    ///
+    /// \param i_rhs the right-hand side(s).
+    /// \param o_solution the solution(s).
+    ///
+    /// \return \p true if the decomposed matrix is positive definite.
+    template < typename RHST >
+    bool Solve( const RHST& i_rhs, typename RHST::MatrixType& o_solution ) const
+    {
+        static_assert( RHST::RowCount() == MatrixType::RowCount() );
+        if ( !m_isPositiveDefinite )
+        {
+            return false;
+        }
+
+        o_solution = i_rhs;
+        _LowerTriangularSolve< /* UNIT_DIAGONAL */ false >( m_factor, o_solution );
+        _LowerTriangularTransposeSolve< /* UNIT_DIAGONAL */ false >( m_factor, o_solution );
+        return true;
+    }
+
+    /// Compute the determinant of the decomposed matrix, as the squared product of the diagonal of \f$L\f$.
+    ///
+    /// \return the determinant.
+    ValueType Determinant() const
+    {
+        ValueType diagonalProduct = m_factor( 0, 0 );
+        for ( int pivotIndex = 1; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            diagonalProduct *= m_factor( pivotIndex, pivotIndex );
+        }
+
+        return diagonalProduct * diagonalProduct;
+    }
+
+    /// Compute the natural logarithm of the determinant of the decomposed matrix.
+    ///
+    /// Unlike Determinant, this does not overflow or underflow for large matrices.
+    ///
+    /// \return the log-determinant.
+    ValueType LogDeterminant() const
+    {
+        ValueType logDiagonalSum = 0;
+        for ( int pivotIndex = 0; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            logDiagonalSum += std::log( m_factor( pivotIndex, pivotIndex ) );
+        }
+
+        return 2 * logDiagonalSum;
+    }
+
+    /// Compute the inverse of the decomposed matrix, by solving against the identity matrix.
+    ///
+    /// \param o_inverse the output inverted matrix.
+    ///
+    /// \return \p true if the decomposed matrix is positive definite.
+    bool Inverse( MatrixType& o_inverse ) const
+    {
+        o_inverse.SetIdentity();
+        return Solve( o_inverse, o_inverse );
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Factors
+    //-------------------------------------------------------------------------
+
+    /// Get the lower triangular factor \f$L\f$.
+    ///
+    /// \return the lower triangular factor.
+    MatrixType L() const
+    {
+        MatrixType lower;
+        for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex <= rowIndex; ++columnIndex )
+            {
+                lower( rowIndex, columnIndex ) = m_factor( rowIndex, columnIndex );
+            }
+        }
+        return lower;
+    }
+
+private:
+    friend struct _ParallelFactorization;
+
+    /// The lower triangular factor, in the lower triangular part.
+    MatrixType m_factor;
+
+    /// Whether the decomposed matrix is positive definite.
+    bool m_isPositiveDefinite = false;
+};
+
+/// \class LDLTDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The \f$LDL^T\f$ decomposition of a symmetric matrix, computed once and reusable across many operations.
+///
+/// Avoids the square roots of CholeskyDecomposition, and extends to symmetric indefinite matrices whose pivots
+/// are non-zero.  Only the lower triangular part of the decomposed matrix is read.
+///
+/// \tparam MatrixT the type of the symmetric matrix to decompose.
+template < typename MatrixT >
+class LDLTDecomposition final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix, and its factors.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    LDLTDecomposition() = default;
+
+    /// Construct the LDL^T decomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    explicit LDLTDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    ///
+    /// \return \p true if all the pivots of \p i_matrix are non-zero.  \p false otherwise, in which case the
+    /// decomposition is not usable.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        m_factor        = i_matrix;
+        m_isNonSingular = _MatrixLDLT( m_factor );
+        return m_isNonSingular;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the decomposed matrix is non-singular, thus the decomposition is usable.
+    ///
+    /// \return \p true if the decomposed matrix is non-singular.
+    inline bool IsNonSingular() const
+    {
+        return m_isNonSingular;
+    }
+
+    /// Solve the linear system \f$AX = B\f$ for \f$X\f$, where \f$A\f$ is the decomposed matrix.
+    ///
+    /// \p i_rhs may be a single column vector \f$b\f$, or a matrix \f$B\f$ whose columns are many right-hand sides.
+    /// \p i_rhs and \p o_solution may refer to the same matrix.
+    ///
+    /// \param i_rhs the right-hand side(s).
+    /// \param o_solution the solution(s).
+    ///
+    /// \return \p true if the decomposed matrix is non-singular.
+    template < typename RHST >
+    bool Solve( const RHST& i_rhs, typename RHST::MatrixType& o_solution ) const
+    {
+        static_assert( RHST::RowCount() == MatrixType::RowCount() );
+        if ( !m_isNonSingular )
+        {
+            return false;
+        }
+
+        o_solution = i_rhs;
+        _LowerTriangularSolve< /* UNIT_DIAGONAL */ true >( m_factor, o_solution );
+
+        // Divide by the diagonal.
+        for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            const ValueType diagonalReciprocal = 1.0 / m_factor( rowIndex, rowIndex );
+            for ( int columnIndex = 0; columnIndex < RHST::ColumnCount(); ++columnIndex )
+            {
+                o_solution( rowIndex, columnIndex ) *= diagonalReciprocal;
+            }
+        }
+
+        _LowerTriangularTransposeSolve< /* UNIT_DIAGONAL */ true >( m_factor, o_solution );
+        return true;
+    }
+
+    /// Compute the determinant of the decomposed matrix, as the product of the diagonal of \f$D\f$.
+    ///
+    /// \return the determinant.
+    ValueType Determinant() const
+    {
+        ValueType determinant = m_factor( 0, 0 );
+        for ( int pivotIndex = 1; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            determinant *= m_factor( pivotIndex, pivotIndex );
+        }
+
+        return determinant;
+    }
+
+    /// Compute the natural logarithm of the \em absolute determinant of the decomposed matrix.
+    ///
+    /// Unlike Determinant, this does not overflow or underflow for large matrices.  The sign of the determinant
+    /// is the sign of Determinant.
+    ///
+    /// \return the log-determinant.
+    ValueType LogDeterminant() const
+    {
+        ValueType logDiagonalSum = 0;
+        for ( int pivotIndex = 0; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            logDiagonalSum += std::log( std::abs( m_factor( pivotIndex, pivotIndex ) ) );
+        }
+
+        return logDiagonalSum;
+    }
+
+    /// Compute the inverse of the decomposed matrix, by solving against the identity matrix.
+    ///
+    /// \param o_inverse the output inverted matrix.
+    ///
+    /// \return \p true if the decomposed matrix is non-singular.
+    bool Inverse( MatrixType& o_inverse ) const
+    {
+        o_inverse.SetIdentity();
+        return Solve( o_inverse, o_inverse );
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Factors
+    //-------------------------------------------------------------------------
+
+    /// Get the unit lower triangular factor \f$L\f$.
+    ///
+    /// \return the unit lower triangular factor.
+    MatrixType L() const
+    {
+        MatrixType lower = MatrixType::Identity();
+        for ( int rowIndex = 1; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex < rowIndex; ++columnIndex )
+            {
+                lower( rowIndex, columnIndex ) = m_factor( rowIndex, columnIndex );
+            }
+        }
+        return lower;
+    }
+
+    /// Get the diagonal factor \f$D\f$.
+    ///
+    /// \return the diagonal factor.
+    MatrixType D() const
+    {
+        MatrixType diagonal;
+        for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            diagonal( rowIndex, rowIndex ) = m_factor( rowIndex, rowIndex );
+        }
+        return diagonal;
+    }
+
+private:
+    /// Packed L and D factors.
+    MatrixType m_factor;
+
+    /// Whether the decomposed matrix is non-singular.
+    bool m_isNonSingular = false;
+};
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,127 @@
+#pragma once
+
+/// \file conjugateGradient.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Conjugate gradient method.
+///
+/// Iteratively solves \f$Ax = b\f$ for a symmetric positive definite \f$A\f$, by minimizing the
+/// \f$A\f$-norm of the error over the Krylov subspace \f$\{b, Ab, A^2b, ...\}\f$, which grows by a dimension per
+/// iteration.  Each iteration costs a single product with \f$A\f$, and a single application of the preconditioner,
+/// if any.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/preconditioner.h>
+
+#include <linear/base/iterativeSolver.h>
+#include <linear/base/matrixElimination.h>
+
+LINEAR_NS_OPEN
+
+/// \class ConjugateGradient
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Solver of symmetric positive definite systems via the conjugate gradient method:
+/// \code{.cpp}
+/// linear::ConjugateGradient< linear::Matrix< 64, 1 > > solver;
+/// solver.SetTolerance( 1e-4f );
+/// linear::Matrix< 64, 1 > solution; // The initial guess.
+/// bool converged = solver.Solve( laplacian, rhs, solution );
+/// \endcode
+///
+/// The operator \f$A\f$ is any type providing \p Apply( x, y ) to compute \f$y = Ax\f$, or a \ref Matrix.  The
+/// workspace vectors are members of the solver, so a solver may be re-used across solves without allocations.
+///
+/// \tparam VectorT the column vector type of the solution and right-hand side.
+template < typename VectorT >
+class ConjugateGradient final : public _IterativeSolver< VectorT >
+{
+public:
+    using typename _IterativeSolver< VectorT >::ValueType;
+
+    /// Solve \f$Ax = b\f$, starting from the initial guess \p io_solution.
+    ///
+    /// \param i_operator the symmetric positive definite operator \f$A\f$.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if \p i_operator was found not to be positive definite, in which case \p io_solution holds the
+    /// last iterate.
+    template < typename OperatorT >
+    inline bool Solve( const OperatorT& i_operator, const VectorT& i_rhs, VectorT& io_solution )
+    {
+        return Solve( i_operator, IdentityPreconditioner< VectorT >(), i_rhs, io_solution );
+    }
+
+    /// Solve \f$Ax = b\f$ preconditioned by \f$M\f$, starting from the initial guess \p io_solution.
+    ///
+    /// \param i_operator the symmetric positive definite operator \f$A\f$.
+    /// \param i_preconditioner the symmetric positive definite preconditioner \f$M\f$, such as
+    /// \ref JacobiPreconditioner or \ref IncompleteCholeskyPreconditioner.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if \p i_operator was found not to be positive definite, in which case \p io_solution holds the
+    /// last iterate.
+    template < typename OperatorT, typename PreconditionerT >
+    bool Solve( const OperatorT&       i_operator,
+                const PreconditionerT& i_preconditioner,
+                const VectorT&         i_rhs,
+                VectorT&               io_solution )
+    {
+        constexpr int   N         = VectorT::RowCount();
+        const ValueType threshold = this->_Begin( i_rhs, io_solution );
+        if ( this->_Residual( i_operator, i_rhs, io_solution, m_residual ) <= threshold )
+        {
+            return true;
+        }
+
+        _ApplyOperator( i_preconditioner, m_residual, m_preconditioned );
+        m_direction               = m_preconditioned;
+        ValueType residualProduct = _DotProduct( &m_residual[ 0 ], &m_preconditioned[ 0 ], N );
+        while ( this->m_iterationCount < this->m_maxIterations )
+        {
+            _ApplyOperator( i_operator, m_direction, m_product );
+            const ValueType curvature = _DotProduct( &m_direction[ 0 ], &m_product[ 0 ], N );
+            if ( !( curvature > 0 ) )
+            {
+                return false;
+            }
+
+            // Step along the direction to the minimum, and update the residual accordingly.
+            const ValueType step = residualProduct / curvature;
+            _EliminateRow( &m_direction[ 0 ], -step, 0, N, &io_solution[ 0 ] );
+            _EliminateRow( &m_product[ 0 ], step, 0, N, &m_residual[ 0 ] );
+            this->m_iterationCount++;
+
+            this->m_residualNorm = _VectorNorm( m_residual );
+            if ( this->m_residualNorm <= threshold )
+            {
+                return true;
+            }
+
+            // The next direction is the preconditioned residual, made A-conjugate to the previous directions.
+            _ApplyOperator( i_preconditioner, m_residual, m_preconditioned );
+            const ValueType nextResidualProduct = _DotProduct( &m_residual[ 0 ], &m_preconditioned[ 0 ], N );
+            const ValueType beta                = nextResidualProduct / residualProduct;
+            for ( int index = 0; index < N; ++index )
+            {
+                m_direction[ index ] = m_preconditioned[ index ] + beta * m_direction[ index ];
+            }
+            residualProduct = nextResidualProduct;
+        }
+
+        return false;
+    }
+
+private:
+    VectorT m_residual;
+    VectorT m_preconditioned;
+    VectorT m_direction;
+    VectorT m_product;
+};
+
+LINEAR_NS_CLOSE
@@ -1,6 +1,6 @@
 #pragma once
 
-/// \file inverse.h
+/// \file determinant.h
 /// \ingroup LinearAlgebra_Operations
 ///
 /// Determinant computation.
@@ -10,77 +10,176 @@
 ///
 /// If the input matrix is singular, then the determinant is \p 0.  If it is non-singular, then
 /// the determinant is non-zero.
+///
+/// Matrices of integral values are instead eliminated fraction-free, which keeps every intermediate an integer,
+/// such that the determinant is exact.
 
-#include <linear/base/matrixElimination.h>
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixBareiss.h>
+#include <linear/base/matrixDeterminant.h>
+#include <linear/base/matrixEntryArray.h>
+#include <linear/base/matrixPivotedQR.h>
 
+#include <linear/eliminationWorkspace.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/pivoting.h>
+
+#include <array>
+#include <type_traits>
 
 LINEAR_NS_OPEN
 
 /// Compute the determinant of a matrix via the product of pivots.
 /// \ingroup LinearAlgebra_Operations
 ///
+/// 1x1 through 4x4 matrices are instead computed in closed-form through cofactor expansion, which can be evaluated
+/// at compile-time, in which case \p PivotT is un-used.
+///
+/// Larger matrices of integral values are computed exactly via fraction-free (Bareiss) elimination, in which case
+/// \p PivotT is un-used too.  Should the determinant overflow the value type, the result is un-defined; see
+/// \ref TryDeterminant, which reports overflow.
+///
 /// \param i_matrix The matrix to compute the determinant for.
 ///
 /// \return The determinant of \p i_matrix.
-template < typename MatrixT >
-inline typename MatrixT::ValueType Determinant( const MatrixT& i_matrix )
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+constexpr inline typename MatrixT::ValueType Determinant( const MatrixT& i_matrix )
 {
-    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
-
-    // Left-hand-side working matrix.  This will assume the identity matrix after the full Gauss-Jordan elimination.
-    MatrixT matrix = i_matrix;
-
-    // Use cache to record on i_matrix.
-    MatrixEntryArray< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
-
-    // Count the number of row exchanges.
-    int numRowExchanges = 0;
-
-    for ( int pivotIndex = 0; pivotIndex < MatrixT::RowCount() - 1; ++pivotIndex )
+    if constexpr ( _HasClosedFormDeterminant< MatrixT >() )
     {
-        // Check that the current pivot is non-zero.
-        if ( matrix( pivotIndex, pivotIndex ) == 0 )
+        return _MatrixDeterminantClosedForm( i_matrix );
+    }
+    else if constexpr ( std::is_integral< typename MatrixT::ValueType >::value )
+    {
+        typename MatrixT::MatrixType matrix      = i_matrix;
+        typename MatrixT::ValueType  determinant = 0;
+        if ( !_MatrixBareissDeterminant( matrix, determinant ) )
         {
-            // Try to find a row below with a non-zero pivot to exchange.
-            int exchangedRow = _FindAndPerformRowExchange( pivotIndex, pivotIndex, matrix );
-            if ( exchangedRow != -1 )
-            {
-                numRowExchanges++;
-            }
-            else
-            {
-                // Matrix is singular, then the determinant is 0.
-                return 0;
-            }
+            LINEAR_ASSERT_MSG( false, "The determinant overflows its value type.\n" );
         }
+        return determinant;
+    }
+    else
+    {
+        // Left-hand-side working matrix, which is reduced to upper triangular form.
+        typename MatrixT::MatrixType matrix = i_matrix;
 
-        // Perform elimination.
-        _RecordElimination( pivotIndex,
-                            pivotIndex,
-                            IntRange( pivotIndex + 1, MatrixT::RowCount() ) /* rowRange */,
-                            IntRange( pivotIndex, MatrixT::ColumnCount() ) /* columnRange */,
-                            eliminationFactors,
-                            matrix );
+        // Use cache to record on the working matrix.
+        MatrixEliminationRecord< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+
+        return _MatrixDeterminant< PivotT >( matrix, eliminationFactors );
     }
+}
 
-    // Compute product of pivots.
-    typename MatrixT::ValueType determinant = matrix( 0, 0 );
-    for ( int pivotIndex = 1; pivotIndex < MatrixT::RowCount(); ++pivotIndex )
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the determinant of a matrix, using the scratch memory of \p io_workspace instead of the stack.
+///
+/// \param i_matrix The matrix to compute the determinant for.
+/// \param io_workspace Reusable scratch memory.
+///
+/// \return The determinant of \p i_matrix.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline typename MatrixT::ValueType
+Determinant( const MatrixT& i_matrix, EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
+{
+    if constexpr ( _HasClosedFormDeterminant< MatrixT >() )
     {
-        determinant *= matrix( pivotIndex, pivotIndex );
+        return _MatrixDeterminantClosedForm( i_matrix );
     }
-
-    // Odd # of row exchanges imparts a -1 factor.
-    if ( numRowExchanges % 2 == 0 )
+    else if constexpr ( std::is_integral< typename MatrixT::ValueType >::value )
     {
+        io_workspace.WorkingMatrix()             = i_matrix;
+        typename MatrixT::ValueType determinant = 0;
+        if ( !_MatrixBareissDeterminant( io_workspace.WorkingMatrix(), determinant ) )
+        {
+            LINEAR_ASSERT_MSG( false, "The determinant overflows its value type.\n" );
+        }
         return determinant;
     }
     else
     {
-        return -determinant;
+        io_workspace.WorkingMatrix() = i_matrix;
+        return _MatrixDeterminant< PivotT >( io_workspace.WorkingMatrix(), io_workspace.EliminationFactors() );
     }
 }
 
+/// Compute the exact determinant of a matrix of integral values via fraction-free (Bareiss) elimination, in
+/// \f$O(n^3)\f$ integer operations, detecting overflow.
+/// \ingroup LinearAlgebra_Operations
+///
+/// Every intermediate value is a minor of \p i_matrix, so the determinant only overflows if the value type cannot
+/// hold one of the minors.
+///
+/// \param i_matrix The matrix to compute the determinant for.
+/// \param o_determinant The determinant of \p i_matrix.
+///
+/// \return \p true if the determinant was computed.  \p false if it, or an intermediate minor, overflows the value
+/// type, in which case \p o_determinant is un-defined.
+template < typename MatrixT >
+inline bool TryDeterminant( const MatrixT& i_matrix, typename MatrixT::ValueType& o_determinant )
+{
+    static_assert( std::is_integral< typename MatrixT::ValueType >::value );
+    typename MatrixT::MatrixType matrix = i_matrix;
+    return _MatrixBareissDeterminant( matrix, o_determinant );
+}
+
+/// Check if a matrix is \em singular (not invertible), through its determinant being exactly \p 0.
+/// \ingroup LinearAlgebra_Operations
+///
+/// Like Determinant, 1x1 through 4x4 matrices are checked in closed-form, which can be evaluated at compile-time.
+///
+/// This is an exact test, intended for matrices of integral values, or of floating point values which are exactly
+/// representable, such as small integers.  Unlike the closed-form \ref Inverse, no relative bound is applied to the
+/// determinant at any size.  The determinant of a singular floating point matrix rarely rounds to
+/// exactly \p 0, so use the overload taking a tolerance to detect numerical singularity.
+///
+/// Above 4x4, the pivots are selected by \p PivotT: with \ref NoPivot, a zero pivot reports a non-singular matrix
+/// which requires a row exchange as singular.
+///
+/// \param i_matrix The matrix to check.
+///
+/// \return \p true if the determinant of \p i_matrix is \p 0.
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+constexpr inline bool IsSingular( const MatrixT& i_matrix )
+{
+    return Determinant< PivotT >( i_matrix ) == 0;
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Check if a matrix is \em numerically singular, through its numerical rank beyond \p i_tolerance being less than
+/// its size.
+///
+/// The rank is revealed by a column pivoted QR decomposition, thus the test is independent of the pivoting policy,
+/// and unlike the determinant, of the scale of the rows.
+///
+/// \param i_matrix The matrix to check.
+/// \param i_tolerance the norm at or below which the remaining columns of the factorization are treated as
+/// dependent.  A typical choice is \f$n \epsilon ||A||\f$.
+///
+/// \pre The values of \p i_matrix must be floating point.
+///
+/// \return \p true if \p i_matrix is numerically singular.
+template < typename MatrixT >
+inline bool IsSingular( const MatrixT& i_matrix, const typename MatrixT::ValueType& i_tolerance )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    static_assert( std::is_floating_point< typename MatrixT::ValueType >::value,
+                   "The numerical singularity test requires floating point values; use IsSingular( matrix ) for "
+                   "integral values." );
+    typename MatrixT::MatrixType               matrix = i_matrix;
+    std::array< int, MatrixT::ColumnCount() > pivotColumns;
+    return _MatrixPivotedQR( matrix, i_tolerance, pivotColumns ) < MatrixT::RowCount();
+}
+
 LINEAR_NS_CLOSE
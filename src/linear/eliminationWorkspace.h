@@ -0,0 +1,112 @@
+#pragma once
+
+/// \file eliminationWorkspace.h
+/// \ingroup LinearAlgebra_Types
+///
+/// Reusable scratch memory for elimination based operations.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/matrixEntryArray.h>
+
+#include <algorithm>
+#include <memory>
+
+LINEAR_NS_OPEN
+
+/// \class EliminationWorkspace
+/// \ingroup LinearAlgebra_Types
+///
+/// Scratch memory for the elimination based operations (\ref Inverse, \ref Determinant, \ref Rank and the
+/// row echelon forms), which can be reused across many calls.
+///
+/// Without a workspace, these operations keep a working copy of the input matrix and their elimination
+/// records on the stack, which for large matrices can exceed the stack size of a thread (a 256 x 256 matrix of
+/// doubles alone is 512 KB).  The workspace allocates its storage on the heap \em once upon construction, so the
+/// workspace object itself is small, and repeated calls neither allocate nor re-initialize scratch memory:
+/// \code{.cpp}
+/// using MatrixT = linear::Matrix< 256, 256, double >;
+/// linear::EliminationWorkspace< MatrixT > workspace;
+/// for ( const MatrixT& matrix : matrices )
+/// {
+///     double determinant = linear::Determinant( matrix, workspace );
+/// }
+/// \endcode
+///
+/// \note A workspace must not be used by multiple threads concurrently.
+///
+/// \tparam MatrixT the type of matrix to perform elimination on.
+template < typename MatrixT >
+class EliminationWorkspace final
+{
+public:
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the working matrix.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    /// \var EliminationRecordType
+    ///
+    /// The type of the elimination factors record.
+    using EliminationRecordType = MatrixEliminationRecord< MatrixT::RowCount(), ValueType >;
+
+    /// \var PivotsType
+    ///
+    /// The type of the array of pivots discovered throughout elimination.
+    using PivotsType = MatrixEntryArray< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, allocating the scratch memory.
+    EliminationWorkspace()
+        : m_storage( new Storage() )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Scratch memory access
+    //-------------------------------------------------------------------------
+
+    /// Get the working matrix, which elimination is performed upon.
+    inline MatrixType& WorkingMatrix()
+    {
+        return m_storage->m_matrix;
+    }
+
+    /// Get the record of elimination factors of a single elimination step.
+    inline EliminationRecordType& EliminationFactors()
+    {
+        return m_storage->m_eliminationFactors;
+    }
+
+    /// Get the array of pivots discovered throughout elimination.
+    inline PivotsType& Pivots()
+    {
+        return m_storage->m_pivots;
+    }
+
+private:
+    /// Heap allocated scratch memory.
+    struct Storage
+    {
+        MatrixType            m_matrix;
+        EliminationRecordType m_eliminationFactors;
+        PivotsType            m_pivots;
+    };
+
+    std::unique_ptr< Storage > m_storage;
+};
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,223 @@
+#pragma once
+
+/// \file gmres.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Restarted generalized minimal residual method, GMRES(m).
+///
+/// Iteratively solves \f$Ax = b\f$ for a general non-singular \f$A\f$, by minimizing the norm of the residual over
+/// the Krylov subspace of the initial residual.  An orthonormal basis of the subspace is built via the Arnoldi
+/// process, along with the Hessenberg matrix \f$H\f$ of \f$A\f$ restricted to it, such that the minimization reduces
+/// to a small least squares problem in \f$H\f$, solved progressively via Givens rotations.
+///
+/// As the basis grows by a vector per iteration, the method is restarted from the current solution every \f$m\f$
+/// iterations, bounding both the memory and the cost of orthogonalization.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/preconditioner.h>
+
+#include <linear/base/iterativeSolver.h>
+#include <linear/base/matrixElimination.h>
+
+#include <array>
+#include <cmath>
+
+LINEAR_NS_OPEN
+
+/// \class GMRES
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Solver of general non-singular systems via the restarted GMRES method:
+/// \code{.cpp}
+/// linear::GMRES< linear::Matrix< 64, 1 >, 16 > solver;
+/// linear::Matrix< 64, 1 > solution; // The initial guess.
+/// bool converged = solver.Solve( advection, rhs, solution );
+/// \endcode
+///
+/// The operator \f$A\f$ is any type providing \p Apply( x, y ) to compute \f$y = Ax\f$, or a \ref Matrix.  The
+/// workspace, including the basis of \p RESTART + 1 vectors, is a member of the solver, so a solver may be re-used
+/// across solves without allocations.
+///
+/// \tparam VectorT the column vector type of the solution and right-hand side.
+/// \tparam RESTART the number of iterations between restarts.
+template < typename VectorT, int RESTART = 30 >
+class GMRES final : public _IterativeSolver< VectorT >
+{
+public:
+    static_assert( RESTART > 0 );
+
+    using typename _IterativeSolver< VectorT >::ValueType;
+
+    /// Solve \f$Ax = b\f$, starting from the initial guess \p io_solution.
+    ///
+    /// \param i_operator the operator \f$A\f$.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if \p i_operator was found to be singular, in which case \p io_solution holds the last iterate.
+    template < typename OperatorT >
+    inline bool Solve( const OperatorT& i_operator, const VectorT& i_rhs, VectorT& io_solution )
+    {
+        return Solve( i_operator, IdentityPreconditioner< VectorT >(), i_rhs, io_solution );
+    }
+
+    /// Solve \f$Ax = b\f$ preconditioned by \f$M\f$, starting from the initial guess \p io_solution.
+    ///
+    /// The system is preconditioned on the right, as \f$AM^{-1}y = b\f$ with \f$x = M^{-1}y\f$, such that the
+    /// minimized residual remains the residual of the original system.
+    ///
+    /// \param i_operator the operator \f$A\f$.
+    /// \param i_preconditioner the preconditioner \f$M\f$, such as \ref IncompleteLUPreconditioner.
+    /// \param i_rhs the right-hand side \f$b\f$.
+    /// \param io_solution the initial guess, replaced by the solution \f$x\f$.
+    ///
+    /// \return \p true if the residual norm met the tolerance.  \p false if the maximum number of iterations was
+    /// reached, or if \p i_operator was found to be singular, in which case \p io_solution holds the last iterate.
+    template < typename OperatorT, typename PreconditionerT >
+    bool Solve( const OperatorT&       i_operator,
+                const PreconditionerT& i_preconditioner,
+                const VectorT&         i_rhs,
+                VectorT&               io_solution )
+    {
+        constexpr int   N         = VectorT::RowCount();
+        const ValueType threshold = this->_Begin( i_rhs, io_solution );
+        while ( true )
+        {
+            // Each cycle starts from the true residual, rather than the estimate, to avoid drifting.
+            const ValueType residualNorm = this->_Residual( i_operator, i_rhs, io_solution, m_basis[ 0 ] );
+            if ( residualNorm <= threshold )
+            {
+                return true;
+            }
+            if ( this->m_iterationCount >= this->m_maxIterations )
+            {
+                return false;
+            }
+
+            for ( int index = 0; index < N; ++index )
+            {
+                m_basis[ 0 ][ index ] /= residualNorm;
+            }
+            m_projectedRhs      = {};
+            m_projectedRhs[ 0 ] = residualNorm;
+            m_hessenberg        = {};
+
+            int basisIndex = 0;
+            while ( basisIndex < RESTART && this->m_iterationCount < this->m_maxIterations )
+            {
+                if ( !_ArnoldiStep( i_operator, i_preconditioner, basisIndex ) )
+                {
+                    return false;
+                }
+                basisIndex++;
+                this->m_iterationCount++;
+
+                // The residual norm of the minimization is the last entry of the rotated right-hand side.
+                this->m_residualNorm = std::abs( m_projectedRhs[ basisIndex ] );
+                if ( this->m_residualNorm <= threshold || m_subdiagonal == 0 )
+                {
+                    break;
+                }
+            }
+
+            // Solve H * y = g, in-place, and apply the correction x += M^-1 * V * y.
+            for ( int index = basisIndex - 1; index >= 0; --index )
+            {
+                ValueType value = m_projectedRhs[ index ];
+                for ( int nextIndex = index + 1; nextIndex < basisIndex; ++nextIndex )
+                {
+                    value -= m_hessenberg[ index ][ nextIndex ] * m_projectedRhs[ nextIndex ];
+                }
+                m_projectedRhs[ index ] = value / m_hessenberg[ index ][ index ];
+            }
+            m_correction = VectorT();
+            for ( int index = 0; index < basisIndex; ++index )
+            {
+                _EliminateRow( &m_basis[ index ][ 0 ], -m_projectedRhs[ index ], 0, N, &m_correction[ 0 ] );
+            }
+            _ApplyOperator( i_preconditioner, m_correction, m_preconditioned );
+            for ( int index = 0; index < N; ++index )
+            {
+                io_solution[ index ] += m_preconditioned[ index ];
+            }
+        }
+    }
+
+private:
+    /// Extend the basis with the (preconditioned) image of basis vector \p i_basisIndex, orthonormalized against the
+    /// previous basis vectors, then reduce the new column of the Hessenberg matrix to upper triangular via Givens
+    /// rotations.
+    ///
+    /// \return \p false if the reduced column has a zero diagonal entry, as \p i_operator is singular.
+    template < typename OperatorT, typename PreconditionerT >
+    bool _ArnoldiStep( const OperatorT& i_operator, const PreconditionerT& i_preconditioner, int i_basisIndex )
+    {
+        constexpr int N         = VectorT::RowCount();
+        VectorT&      nextBasis = m_basis[ i_basisIndex + 1 ];
+        _ApplyOperator( i_preconditioner, m_basis[ i_basisIndex ], m_preconditioned );
+        _ApplyOperator( i_operator, m_preconditioned, nextBasis );
+
+        // Modified Gram-Schmidt.
+        for ( int index = 0; index <= i_basisIndex; ++index )
+        {
+            const ValueType projection            = _DotProduct( &m_basis[ index ][ 0 ], &nextBasis[ 0 ], N );
+            m_hessenberg[ index ][ i_basisIndex ] = projection;
+            _EliminateRow( &m_basis[ index ][ 0 ], projection, 0, N, &nextBasis[ 0 ] );
+        }
+
+        m_subdiagonal = _VectorNorm( nextBasis );
+        if ( m_subdiagonal != 0 )
+        {
+            for ( int index = 0; index < N; ++index )
+            {
+                nextBasis[ index ] /= m_subdiagonal;
+            }
+        }
+
+        // Apply the previous rotations to the new column.
+        for ( int index = 0; index < i_basisIndex; ++index )
+        {
+            const ValueType upper                     = m_hessenberg[ index ][ i_basisIndex ];
+            const ValueType lower                     = m_hessenberg[ index + 1 ][ i_basisIndex ];
+            m_hessenberg[ index ][ i_basisIndex ]     = m_cosines[ index ] * upper + m_sines[ index ] * lower;
+            m_hessenberg[ index + 1 ][ i_basisIndex ] = m_cosines[ index ] * lower - m_sines[ index ] * upper;
+        }
+
+        // Then the rotation which annihilates the sub-diagonal entry, to both the column and the right-hand side.
+        const ValueType diagonal = m_hessenberg[ i_basisIndex ][ i_basisIndex ];
+        const ValueType radius   = std::hypot( diagonal, m_subdiagonal );
+        if ( radius == 0 )
+        {
+            return false;
+        }
+
+        m_cosines[ i_basisIndex ]                    = diagonal / radius;
+        m_sines[ i_basisIndex ]                      = m_subdiagonal / radius;
+        m_hessenberg[ i_basisIndex ][ i_basisIndex ] = radius;
+        m_projectedRhs[ i_basisIndex + 1 ]           = -m_sines[ i_basisIndex ] * m_projectedRhs[ i_basisIndex ];
+        m_projectedRhs[ i_basisIndex ]               = m_cosines[ i_basisIndex ] * m_projectedRhs[ i_basisIndex ];
+        return true;
+    }
+
+    /// The orthonormal basis of the Krylov subspace.
+    std::array< VectorT, RESTART + 1 > m_basis;
+
+    /// The Hessenberg matrix, reduced to upper triangular, and the rotations which reduced it.
+    ///
+    /// The rows are plain arrays rather than a \ref Matrix, as it is only ever indexed, and the entry count of a
+    /// \ref Matrix bounds the depth of the template recursion of its operations.
+    std::array< std::array< ValueType, RESTART >, RESTART + 1 > m_hessenberg;
+    std::array< ValueType, RESTART >                          m_cosines;
+    std::array< ValueType, RESTART >                          m_sines;
+    ValueType                                                 m_subdiagonal = 0;
+
+    /// The right-hand side of the least squares problem in the Hessenberg matrix, rotated alongside it.
+    std::array< ValueType, RESTART + 1 > m_projectedRhs;
+
+    VectorT m_preconditioned;
+    VectorT m_correction;
+};
+
+LINEAR_NS_CLOSE
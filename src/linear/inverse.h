@@ -11,27 +11,116 @@
 /// \endcode
 /// where \p I is the identity matrix.
 
+#include <linear/base/matrixBlockedLU.h>
 #include <linear/base/matrixInverse.h>
+#include <linear/base/matrixInverseClosedForm.h>
 
+#include <linear/eliminationWorkspace.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/pivoting.h>
+#include <linear/taggedMatrix.h>
+
+#include <type_traits>
 
 LINEAR_NS_OPEN
 
+/// Matrices of this size or larger are inverted through the blocked LU decomposition rather than Gauss-Jordan
+/// elimination.
+constexpr int _LU_INVERSE_SIZE = 16;
+
 /// Compute the inverse of a matrix via <b>Gauss-Jordan Elimination</b>.
 /// \ingroup LinearAlgebra_Operations
 ///
 /// If matrix \p i_matrix is invertible, store its computed inverse in \p o_inverse.
 ///
+/// Under the default pivoting policy, 2x2, 3x3 and 4x4 matrices are instead inverted in closed-form, through their
+/// adjugate and determinant, and treated as singular if the determinant is negligible relative to the norms of
+/// their rows.  A \ref TaggedMatrix is inverted through the inverse provided by its property, in which case
+/// \p PivotT is un-used.
+///
+/// Matrices of 16 or more rows are instead factored by a blocked LU decomposition, whose trailing updates run as
+/// matrix multiplications rather than row operations.  The factors are computed, then inverted, in-place within
+/// \p o_inverse, thus no scratch matrix is allocated.
+///
+/// \note The test for singularity depends on the size.  The closed-form inverses reject a determinant within
+/// \f$n \epsilon \prod_i ||a_i||\f$ of zero, which also catches singular matrices whose determinant rounds to a tiny
+/// non-zero value.  Elimination only rejects an exactly zero pivot, thus such a matrix of 5 or more rows, or under
+/// another pivoting policy, is inverted into meaningless, huge entries.  The relative bound is not applied to
+/// elimination, as the determinant of a well-conditioned matrix shrinks exponentially relative to the bound as
+/// its size grows.  Use \ref IsSingular with a tolerance beforehand for a test which does not depend on the size.
+///
 /// \pre The matrix \p i_matrix must be square.
 ///
 /// \param o_inverse the output inverted matrix.
 ///
 /// \return \p true if i_matrix is invertible. \p false if \p i_matrix is singular (thus cannot be inverted).
-template < typename MatrixT >
-inline bool Inverse( const MatrixT& i_matrix, MatrixT& o_inverse )
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline bool Inverse( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+{
+    if constexpr ( _IsTaggedMatrix< MatrixT >::value )
+    {
+        LINEAR_ASSERT( MatrixT::PropertyType::Check( i_matrix ) );
+        MatrixT::PropertyType::Inverse( i_matrix, o_inverse );
+        return true;
+    }
+    else if constexpr ( _HasClosedFormInverse< MatrixT >() && std::is_same< PivotT, ZeroPivot >::value )
+    {
+        return _MatrixInverseClosedForm( i_matrix, o_inverse );
+    }
+    else if constexpr ( MatrixT::RowCount() >= _LU_INVERSE_SIZE )
+    {
+        return _MatrixInverseBlockedLU< PivotT >( i_matrix, o_inverse );
+    }
+    else
+    {
+        return _MatrixInverse< PivotT >( i_matrix, o_inverse );
+    }
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the inverse of a matrix, using the scratch memory of \p io_workspace instead of the stack.
+///
+/// Matrices which are not inverted in closed-form are inverted within \p io_workspace by Gauss-Jordan elimination,
+/// below 16 rows.  Larger matrices are inverted in-place within \p o_inverse, as in the overload without a
+/// workspace, thus \p io_workspace is un-used.
+///
+/// \param o_inverse the output inverted matrix.
+/// \param io_workspace reusable scratch memory.
+///
+/// \return \p true if i_matrix is invertible. \p false if \p i_matrix is singular (thus cannot be inverted).
+///
+/// \tparam PivotT the pivoting policy.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline bool Inverse( const MatrixT&                                        i_matrix,
+                     typename MatrixT::MatrixType&                         o_inverse,
+                     EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
 {
-    return _MatrixInverse( i_matrix, o_inverse );
+    if constexpr ( _IsTaggedMatrix< MatrixT >::value )
+    {
+        LINEAR_ASSERT( MatrixT::PropertyType::Check( i_matrix ) );
+        MatrixT::PropertyType::Inverse( i_matrix, o_inverse );
+        return true;
+    }
+    else if constexpr ( _HasClosedFormInverse< MatrixT >() && std::is_same< PivotT, ZeroPivot >::value )
+    {
+        return _MatrixInverseClosedForm( i_matrix, o_inverse );
+    }
+    else if constexpr ( MatrixT::RowCount() >= _LU_INVERSE_SIZE )
+    {
+        return _MatrixInverseBlockedLU< PivotT >( i_matrix, o_inverse );
+    }
+    else
+    {
+        io_workspace.WorkingMatrix() = i_matrix;
+        return _MatrixInverse< PivotT >( io_workspace.WorkingMatrix(),
+                                         o_inverse,
+                                         io_workspace.EliminationFactors() );
+    }
 }
 
 LINEAR_NS_CLOSE
@@ -0,0 +1,199 @@
+#pragma once
+
+/// \file inverseUpdate.h
+/// \ingroup LinearAlgebra_Operations
+///
+/// Low rank updates of a matrix inverse.
+///
+/// When a matrix \f$A\f$ changes by a low rank term, its known inverse is updated directly rather than computed
+/// again from scratch, via the <b>Sherman-Morrison</b> formula
+/// \f[
+/// (A + uv^T)^{-1} = A^{-1} - \frac{A^{-1}uv^TA^{-1}}{1 + v^TA^{-1}u}
+/// \f]
+/// or its rank \f$k\f$ generalization, the <b>Woodbury</b> identity
+/// \f[
+/// (A + UV^T)^{-1} = A^{-1} - A^{-1}U(I + V^TA^{-1}U)^{-1}V^TA^{-1}
+/// \f]
+///
+/// The small matrix \f$C = I + V^TA^{-1}U\f$ is the \em capacitance matrix.  If it is nearly singular relative to the
+/// size of its terms, the update suffers from cancellation, and the inverse is instead re-computed from the updated
+/// matrix.
+
+#include <linear/inverse.h>
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/multiply.h>
+#include <linear/pivoting.h>
+#include <linear/transpose.h>
+
+#include <linear/base/matrixElimination.h>
+
+#include <cmath>
+#include <limits>
+
+LINEAR_NS_OPEN
+
+/// Check if an update whose capacitance matrix inverse has norm \p i_capacitanceInverseNorm, and whose terms are
+/// bounded by \p i_termScale, is numerically safe to apply.
+template < typename ValueT >
+inline bool _IsInverseUpdateSafe( const ValueT& i_capacitanceInverseNorm, const ValueT& i_termScale )
+{
+    // Losing more than half the digits to cancellation is unsafe.
+    return i_capacitanceInverseNorm * i_termScale * std::sqrt( std::numeric_limits< ValueT >::epsilon() ) < 1;
+}
+
+/// Compute the Frobenius norm of \p i_matrix.
+template < typename MatrixT >
+inline typename MatrixT::ValueType _FrobeniusNorm( const MatrixT& i_matrix )
+{
+    return std::sqrt( _DotProduct( &i_matrix[ 0 ], &i_matrix[ 0 ], MatrixT::EntryCount() ) );
+}
+
+/// Apply the rank 1 update \f$A + uv^T\f$ to matrix \p io_matrix, and update its inverse \p io_inverse accordingly
+/// via the Sherman-Morrison formula, in \f$O(n^2)\f$.
+/// \ingroup LinearAlgebra_Operations
+///
+/// If the update is numerically unsafe, the inverse is instead re-computed from the updated matrix via
+/// \ref Inverse.
+///
+/// \param i_u the column vector \f$u\f$.
+/// \param i_v the column vector \f$v\f$.
+/// \param io_matrix the square matrix \f$A\f$, to update.
+/// \param io_inverse the inverse of \p io_matrix, to update.
+///
+/// \return \p true if the updated matrix is invertible.  \p false otherwise, in which case \p io_inverse is
+/// un-defined.
+///
+/// \tparam PivotT the pivoting policy, should the inverse be re-computed.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline bool InverseRankOneUpdate( const Matrix< MatrixT::RowCount(), 1, typename MatrixT::ValueType >& i_u,
+                                  const Matrix< MatrixT::RowCount(), 1, typename MatrixT::ValueType >& i_v,
+                                  MatrixT&                                                             io_matrix,
+                                  MatrixT&                                                             io_inverse )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    using ValueT    = typename MatrixT::ValueType;
+    using ColumnT   = Matrix< MatrixT::RowCount(), 1, ValueT >;
+    constexpr int N = MatrixT::RowCount();
+
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        _EliminateRow( &i_v[ 0 ], -i_u[ rowIndex ], 0, N, &io_matrix( rowIndex, 0 ) );
+    }
+
+    // w = A^-1 * u, and z = v^T * A^-1, accumulated row by row.
+    ColumnT inverseU;
+    ColumnT vInverse;
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        inverseU[ rowIndex ] = _DotProduct( &io_inverse( rowIndex, 0 ), &i_u[ 0 ], N );
+        _EliminateRow( &io_inverse( rowIndex, 0 ), -i_v[ rowIndex ], 0, N, &vInverse[ 0 ] );
+    }
+
+    const ValueT capacitance = 1 + _DotProduct( &i_v[ 0 ], &inverseU[ 0 ], N );
+    const ValueT termScale   = 1 + _FrobeniusNorm( i_v ) * _FrobeniusNorm( inverseU );
+    if ( capacitance == 0 || !_IsInverseUpdateSafe< ValueT >( 1 / std::abs( capacitance ), termScale ) )
+    {
+        return Inverse< PivotT >( io_matrix, io_inverse );
+    }
+
+    // A^-1 -= w * z / (1 + v^T * w)
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        _EliminateRow( &vInverse[ 0 ], inverseU[ rowIndex ] / capacitance, 0, N, &io_inverse( rowIndex, 0 ) );
+    }
+
+    return true;
+}
+
+/// Apply the rank \f$k\f$ update \f$A + UV^T\f$ to matrix \p io_matrix, and update its inverse \p io_inverse
+/// accordingly via the Woodbury identity, in \f$O(n^2k)\f$.
+/// \ingroup LinearAlgebra_Operations
+///
+/// If the \f$k \times k\f$ capacitance matrix is singular, or the update is otherwise numerically unsafe, the
+/// inverse is instead re-computed from the updated matrix via \ref Inverse.
+///
+/// \param i_u the \f$n \times k\f$ matrix \f$U\f$.
+/// \param i_v the \f$n \times k\f$ matrix \f$V\f$.
+/// \param io_matrix the square matrix \f$A\f$, to update.
+/// \param io_inverse the inverse of \p io_matrix, to update.
+///
+/// \return \p true if the updated matrix is invertible.  \p false otherwise, in which case \p io_inverse is
+/// un-defined.
+///
+/// \tparam PivotT the pivoting policy, should the inverse be re-computed.
+template < typename PivotT = ZeroPivot, typename MatrixT, typename UpdateT >
+inline bool InverseLowRankUpdate( const UpdateT& i_u, const UpdateT& i_v, MatrixT& io_matrix, MatrixT& io_inverse )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    static_assert( UpdateT::RowCount() == MatrixT::RowCount() );
+    using ValueT    = typename MatrixT::ValueType;
+    constexpr int N = MatrixT::RowCount();
+    constexpr int K = UpdateT::ColumnCount();
+
+    // A += U * V^T, with the rows of V^T being contiguous.
+    const Matrix< K, N, ValueT > transposedV = Transpose( i_v );
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        for ( int updateIndex = 0; updateIndex < K; ++updateIndex )
+        {
+            _EliminateRow(
+                &transposedV( updateIndex, 0 ), -i_u( rowIndex, updateIndex ), 0, N, &io_matrix( rowIndex, 0 ) );
+        }
+    }
+
+    // W = A^-1 * U, Z = V^T * A^-1 and C = I + V^T * W, accumulated row by row.
+    Matrix< N, K, ValueT > inverseU;
+    Matrix< K, N, ValueT > vInverse;
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        for ( int columnIndex = 0; columnIndex < N; ++columnIndex )
+        {
+            _EliminateRow(
+                &i_u( columnIndex, 0 ), -io_inverse( rowIndex, columnIndex ), 0, K, &inverseU( rowIndex, 0 ) );
+        }
+
+        for ( int updateIndex = 0; updateIndex < K; ++updateIndex )
+        {
+            _EliminateRow(
+                &io_inverse( rowIndex, 0 ), -i_v( rowIndex, updateIndex ), 0, N, &vInverse( updateIndex, 0 ) );
+        }
+    }
+
+    Matrix< K, K, ValueT > capacitance;
+    for ( int updateIndex = 0; updateIndex < K; ++updateIndex )
+    {
+        capacitance( updateIndex, updateIndex ) = 1;
+    }
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        for ( int updateIndex = 0; updateIndex < K; ++updateIndex )
+        {
+            _EliminateRow(
+                &inverseU( rowIndex, 0 ), -i_v( rowIndex, updateIndex ), 0, K, &capacitance( updateIndex, 0 ) );
+        }
+    }
+
+    Matrix< K, K, ValueT > capacitanceInverse;
+    const ValueT           termScale = 1 + _FrobeniusNorm( i_v ) * _FrobeniusNorm( inverseU );
+    if ( !Inverse< PivotT >( capacitance, capacitanceInverse ) ||
+         !_IsInverseUpdateSafe( _FrobeniusNorm( capacitanceInverse ), termScale ) )
+    {
+        return Inverse< PivotT >( io_matrix, io_inverse );
+    }
+
+    // A^-1 -= W * (C^-1 * Z)
+    const Matrix< K, N, ValueT > correction = Multiply( capacitanceInverse, vInverse );
+    for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+    {
+        for ( int updateIndex = 0; updateIndex < K; ++updateIndex )
+        {
+            _EliminateRow(
+                &correction( updateIndex, 0 ), inverseU( rowIndex, updateIndex ), 0, N, &io_inverse( rowIndex, 0 ) );
+        }
+    }
+
+    return true;
+}
+
+LINEAR_NS_CLOSE
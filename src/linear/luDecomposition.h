@@ -0,0 +1,237 @@
+#pragma once
+
+/// \file luDecomposition.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// LU decomposition.
+///
+/// A square matrix \f$A\f$ is factored into
+/// \f[
+/// PA = LU
+/// \f]
+/// where \f$P\f$ is a row permutation, \f$L\f$ is lower triangular with 1's down its diagonal (the elimination
+/// factors), and \f$U\f$ is upper triangular (the result of elimination).
+///
+/// Once factored, linear systems, the determinant and the inverse can be computed without repeating elimination.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/pivoting.h>
+#include <linear/row.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixBlockedLU.h>
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixEntryArray.h>
+
+#include <array>
+
+LINEAR_NS_OPEN
+
+struct _ParallelFactorization;
+
+/// \class LUDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The LU decomposition of a square matrix, computed once and reusable across many operations:
+/// \code{.cpp}
+/// linear::LUDecomposition< linear::Matrix< 3, 3 > > lu( matrix );
+/// linear::Matrix< 3, 1 > x;
+/// for ( const linear::Matrix< 3, 1 >& b : rightHandSides )
+/// {
+///     lu.Solve( b, x );
+/// }
+/// \endcode
+///
+/// The factors are computed by recording the elimination factors of each pivot step, which become the entries
+/// of \f$L\f$.  Solving replays the same elimination onto the right-hand side, followed by back substitution.
+///
+/// Matrices larger than \p BLOCK_SIZE are factored in panels of \p BLOCK_SIZE columns, with the trailing matrix
+/// updated by a cache-blocked matrix multiplication after each panel.  See \ref parallelFactorization.h to factor
+/// across multiple threads.
+///
+/// L and U are stored packed in a single matrix, where the strictly lower triangular part holds \f$L\f$ (its unit
+/// diagonal is implicit), and the remaining upper triangular part holds \f$U\f$.
+///
+/// \tparam MatrixT the type of the square matrix to decompose.
+/// \tparam PivotT the pivoting policy.
+/// \tparam BLOCK_SIZE the number of columns per panel.
+template < typename MatrixT, typename PivotT = ZeroPivot, size_t BLOCK_SIZE = _LU_BLOCK_SIZE >
+class LUDecomposition final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix, and its factors.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    LUDecomposition() = default;
+
+    /// Construct the LU decomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    explicit LUDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// A singular matrix is still factored, with at least one zero pivot in \f$U\f$.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    ///
+    /// \return \p true if \p i_matrix is non-singular.  \p false otherwise.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        m_lu            = i_matrix;
+        m_isNonSingular = _MatrixBlockedLU< BLOCK_SIZE, PivotT >( m_lu, m_pivotRows, m_rowExchanges );
+        return m_isNonSingular;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the decomposed matrix is non-singular (invertible).
+    ///
+    /// \return \p true if the decomposed matrix is non-singular.
+    inline bool IsNonSingular() const
+    {
+        return m_isNonSingular;
+    }
+
+    /// Solve the linear system \f$AX = B\f$ for \f$X\f$, where \f$A\f$ is the decomposed matrix.
+    ///
+    /// \p i_rhs may be a single column vector \f$b\f$, or a matrix \f$B\f$ whose columns are many right-hand sides.
+    /// \p i_rhs and \p o_solution may refer to the same matrix.
+    ///
+    /// \param i_rhs the right-hand side(s).
+    /// \param o_solution the solution(s).
+    ///
+    /// \return \p true if the decomposed matrix is non-singular, thus the system has a unique solution.
+    template < typename RHST >
+    bool Solve( const RHST& i_rhs, typename RHST::MatrixType& o_solution ) const
+    {
+        static_assert( RHST::RowCount() == MatrixType::RowCount() );
+        if ( !m_isNonSingular )
+        {
+            return false;
+        }
+
+        o_solution = i_rhs;
+        _LUSolve( m_lu, m_pivotRows, o_solution );
+        return true;
+    }
+
+    /// Compute the determinant of the decomposed matrix, as the signed product of the pivots.
+    ///
+    /// \return the determinant.
+    ValueType Determinant() const
+    {
+        ValueType determinant = m_lu( 0, 0 );
+        for ( int pivotIndex = 1; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            determinant *= m_lu( pivotIndex, pivotIndex );
+        }
+
+        // Odd # of row exchanges imparts a -1 factor.
+        return m_rowExchanges % 2 == 0 ? determinant : -determinant;
+    }
+
+    /// Compute the inverse of the decomposed matrix, by solving against the identity matrix.
+    ///
+    /// \param o_inverse the output inverted matrix.
+    ///
+    /// \return \p true if the decomposed matrix is invertible.  \p false if it is singular.
+    bool Inverse( MatrixType& o_inverse ) const
+    {
+        o_inverse.SetIdentity();
+        return Solve( o_inverse, o_inverse );
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Factors
+    //-------------------------------------------------------------------------
+
+    /// Get the lower triangular factor \f$L\f$, with 1's down its diagonal.
+    ///
+    /// \return the lower triangular factor.
+    MatrixType L() const
+    {
+        MatrixType lower = MatrixType::Identity();
+        for ( int rowIndex = 1; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex < rowIndex; ++columnIndex )
+            {
+                lower( rowIndex, columnIndex ) = m_lu( rowIndex, columnIndex );
+            }
+        }
+        return lower;
+    }
+
+    /// Get the upper triangular factor \f$U\f$.
+    ///
+    /// \return the upper triangular factor.
+    MatrixType U() const
+    {
+        MatrixType upper;
+        for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = rowIndex; columnIndex < MatrixType::ColumnCount(); ++columnIndex )
+            {
+                upper( rowIndex, columnIndex ) = m_lu( rowIndex, columnIndex );
+            }
+        }
+        return upper;
+    }
+
+    /// Get the row permutation matrix \f$P\f$.
+    ///
+    /// \return the permutation matrix.
+    MatrixType P() const
+    {
+        MatrixType permutation = MatrixType::Identity();
+        for ( int pivotIndex = 0; pivotIndex < MatrixType::RowCount(); ++pivotIndex )
+        {
+            if ( m_pivotRows[ pivotIndex ] != pivotIndex )
+            {
+                RowExchange( pivotIndex, m_pivotRows[ pivotIndex ], permutation );
+            }
+        }
+        return permutation;
+    }
+
+private:
+    friend struct _ParallelFactorization;
+
+    /// Packed L and U factors.
+    MatrixType m_lu;
+
+    /// The row which was exchanged with each pivot row, in order of elimination.
+    std::array< CompactIndexType< MatrixType::RowCount() >, MatrixType::RowCount() > m_pivotRows{};
+
+    /// Number of row exchanges performed.
+    int m_rowExchanges = 0;
+
+    /// Whether the decomposed matrix is non-singular.
+    bool m_isNonSingular = false;
+};
+
+LINEAR_NS_CLOSE
@@ -18,6 +18,7 @@
 #include <cmath>
 #include <cstring>
 #include <sstream>
+#include <type_traits>
 
 LINEAR_NS_OPEN
 
@@ -73,6 +74,24 @@ public:
         static_assert( sizeof...( i_entries ) == EntryCount() );
     }
 
+    /// Matrix view constructor, materializing the entries referenced by \p i_view.
+    ///
+    /// A matrix view (such as \ref TransposeView) is any type whose \p MatrixType is the current matrix type,
+    /// providing read-access to its entries through operator()( row, column ).
+    template < typename ViewT,
+               typename std::enable_if< std::is_same< typename ViewT::MatrixType, MatrixType >::value &&
+                                        !std::is_same< ViewT, MatrixType >::value >::type* = nullptr >
+    constexpr Matrix( const ViewT& i_view )
+    {
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+            {
+                m_entries[ rowIndex * COLS + columnIndex ] = i_view( rowIndex, columnIndex );
+            }
+        }
+    }
+
 #ifdef LINEAR_DEBUG
     /// Copy constructor.
     Matrix( const MatrixType& i_matrix )
@@ -22,11 +22,15 @@ LINEAR_NS_OPEN
 ///
 /// \return The normalized column vector.
 template < typename MatrixT >
-constexpr inline MatrixT Normalize( const MatrixT& i_columnVector )
+constexpr inline typename MatrixT::MatrixType Normalize( const MatrixT& i_columnVector )
 {
     static_assert( MatrixT::ColumnCount() == 1 );
-    LINEAR_ASSERT( Multiply( Transpose( i_columnVector ), i_columnVector )[ 0 ] != 0 );
-    return i_columnVector / ( float ) sqrt( Multiply( Transpose( i_columnVector ), i_columnVector )[ 0 ] );
+
+    // Binds directly to a Matrix, or materializes a matrix view.
+    const typename MatrixT::MatrixType& columnVector = i_columnVector;
+    LINEAR_ASSERT( Multiply( Transpose( columnVector ), columnVector )[ 0 ] != 0 );
+    return columnVector /
+           ( typename MatrixT::ValueType ) sqrt( Multiply( Transpose( columnVector ), columnVector )[ 0 ] );
 }
 
 LINEAR_NS_CLOSE
@@ -13,41 +13,112 @@
 /// The columns of \f$Q\f$ is independent, mutually orthogonal, and all possess the length of 1.
 
 #include <linear/matrix.h>
-#include <linear/normalize.h>
-#include <linear/projection.h>
+#include <linear/transpose.h>
+
+#include <linear/base/matrixGramSchmidt.h>
+
+#include <algorithm>
+#include <array>
 
 LINEAR_NS_OPEN
 
-/// Compute the orthonormal matrix of an input matrix via the <b>Gram-Schmidt</b> process.
+/// Compute the orthonormal matrix of an input matrix via the <b>modified Gram-Schmidt</b> process.
 /// \ingroup LinearAlgebra_Operations
 ///
+/// \p i_matrix and \p o_orthonormal may refer to the same matrix.
+///
 /// \pre \p i_matrix must have independent columns.
 ///
 /// \param i_matrix The input matrix.
+/// \param o_orthonormal The orthonormalized matrix.
+///
+/// \tparam PASSES the number of orthogonalization passes per column.  Specify \p 2 to re-orthogonalize, for
+/// matrices with nearly dependent columns.
+template < size_t PASSES = 1, typename MatrixT >
+inline void Orthonormalize( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_orthonormal )
+{
+    // The columns are orthonormalized as the rows of the transpose, so that they are contiguous in memory.
+    Matrix< MatrixT::ColumnCount(), MatrixT::RowCount(), typename MatrixT::ValueType > rows = Transpose( i_matrix );
+    _MatrixGramSchmidtRows< PASSES >( rows );
+    o_orthonormal = Transpose( rows );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// \pre \p i_matrix must have independent columns.
+///
+/// \param i_matrix The input matrix.
+///
+/// \tparam PASSES the number of orthogonalization passes per column.
 ///
 /// \return Orthonormalized matrix.
-template < typename MatrixT >
-inline MatrixT Orthonormalize( const MatrixT& i_matrix )
+template < size_t PASSES = 1, typename MatrixT >
+inline typename MatrixT::MatrixType Orthonormalize( const MatrixT& i_matrix )
 {
-    using ColumnT = Matrix< MatrixT::RowCount(), 1 >;
+    typename MatrixT::MatrixType orthonormal;
+    Orthonormalize< PASSES >( i_matrix, orthonormal );
+    return orthonormal;
+}
 
-    // Normalize and set the first column.
-    MatrixT orthonormal;
-    orthonormal.SetColumn( 0, Normalize( i_matrix.GetColumn( 0 ) ) );
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Orthonormalize a batch of \p i_count matrices, such as re-orthonormalizing rotation matrices which have
+/// drifted due to accumulated rounding errors.
+///
+/// The matrices are processed in groups, interleaved such that each operation is vectorized across the matrices
+/// of a group.  \p i_matrices and \p o_orthonormals may refer to the same array.
+///
+/// \pre Every matrix must have independent columns.
+///
+/// \param i_matrices The input matrices.
+/// \param i_count The number of matrices.
+/// \param o_orthonormals The orthonormalized matrices.
+///
+/// \tparam PASSES the number of orthogonalization passes per column.
+template < size_t PASSES = 1, size_t ROWS, size_t COLS, typename ValueT >
+inline void Orthonormalize( const Matrix< ROWS, COLS, ValueT >* i_matrices,
+                            size_t                              i_count,
+                            Matrix< ROWS, COLS, ValueT >*       o_orthonormals )
+{
+    constexpr size_t LANES = 8;
 
-    for ( int columnIndex : IntRange( 1, MatrixT::ColumnCount() ) )
+    std::array< ValueT, ROWS * COLS * LANES > lanes;
+    for ( size_t batchBegin = 0; batchBegin < i_count; batchBegin += LANES )
     {
-        ColumnT column = i_matrix.GetColumn( columnIndex );
-        for ( int projectionIndex : IntRange( 0, columnIndex ) )
+        const size_t batchSize = std::min( LANES, i_count - batchBegin );
+
+        // Interleave the matrices.  Unused lanes are filled with the identity to keep them well-defined.
+        for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
         {
-            ColumnT projection = Projection( column, orthonormal.GetColumn( projectionIndex ) );
-            LINEAR_VERIFY( projection != ColumnT() );
-            column -= projection;
+            for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+            {
+                ValueT* entryLanes = &lanes[ ( columnIndex * ROWS + rowIndex ) * LANES ];
+                for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                {
+                    entryLanes[ laneIndex ] = laneIndex < batchSize
+                                                  ? i_matrices[ batchBegin + laneIndex ]( rowIndex, columnIndex )
+                                                  : ( rowIndex == columnIndex ? 1 : 0 );
+                }
+            }
         }
-        orthonormal.SetColumn( columnIndex, Normalize( column ) );
-    }
 
-    return orthonormal;
+        _MatrixGramSchmidtLanes< PASSES, ROWS, COLS, LANES >( lanes );
+
+        // De-interleave.
+        for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+        {
+            for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+            {
+                const ValueT* entryLanes = &lanes[ ( columnIndex * ROWS + rowIndex ) * LANES ];
+                for ( size_t laneIndex = 0; laneIndex < batchSize; ++laneIndex )
+                {
+                    o_orthonormals[ batchBegin + laneIndex ]( rowIndex, columnIndex ) = entryLanes[ laneIndex ];
+                }
+            }
+        }
+    }
 }
 
 LINEAR_NS_CLOSE
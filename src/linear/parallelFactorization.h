@@ -0,0 +1,94 @@
+#pragma once
+
+/// \file parallelFactorization.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Task-parallel factorization of the \ref LUDecomposition and \ref CholeskyDecomposition.
+///
+/// The factorizations are expressed as a graph of tasks over square tiles of the matrix, executed on a
+/// \ref TaskPool, such that the updates of later steps overlap with the factorization of earlier panels.
+///
+/// They are kept apart from the decompositions themselves, as the pool runs on \p std::thread: including this
+/// header requires linking the \p linear_parallel CMake target, or the platform's threads library.
+
+#include <linear/choleskyDecomposition.h>
+#include <linear/linear.h>
+#include <linear/luDecomposition.h>
+#include <linear/taskPool.h>
+
+#include <linear/base/matrixTiledFactorization.h>
+
+LINEAR_NS_OPEN
+
+/// \struct _ParallelFactorization
+///
+/// Access to the factors of the decompositions, for the parallel factorizations to compute in-place.
+struct _ParallelFactorization
+{
+    template < size_t TILE_SIZE, typename MatrixT, typename PivotT, size_t BLOCK_SIZE >
+    static bool Factorize( const MatrixT&                                  i_matrix,
+                           TaskPool&                                       io_pool,
+                           LUDecomposition< MatrixT, PivotT, BLOCK_SIZE >& io_decomposition )
+    {
+        io_decomposition.m_lu            = i_matrix;
+        io_decomposition.m_isNonSingular = _MatrixTiledLU< TILE_SIZE, PivotT >(
+            io_decomposition.m_lu, io_decomposition.m_pivotRows, io_decomposition.m_rowExchanges, io_pool );
+        return io_decomposition.m_isNonSingular;
+    }
+
+    template < size_t TILE_SIZE, typename MatrixT >
+    static bool
+    Factorize( const MatrixT& i_matrix, TaskPool& io_pool, CholeskyDecomposition< MatrixT >& io_decomposition )
+    {
+        io_decomposition.m_factor             = i_matrix;
+        io_decomposition.m_isPositiveDefinite =
+            _MatrixTiledCholesky< TILE_SIZE >( io_decomposition.m_factor, io_pool );
+        return io_decomposition.m_isPositiveDefinite;
+    }
+};
+
+/// Factorize \p i_matrix into the LU decomposition \p io_decomposition in parallel on \p io_pool, replacing its
+/// current decomposition.
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The results are identical to the serial factorization with a \p BLOCK_SIZE of \p TILE_SIZE, regardless of the
+/// number of threads.
+///
+/// \param io_decomposition the decomposition to replace.
+/// \param i_matrix the matrix to decompose.
+/// \param io_pool the pool of threads executing the tasks.
+///
+/// \return \p true if \p i_matrix is non-singular.  \p false otherwise.
+///
+/// \tparam TILE_SIZE the number of rows and columns per tile.  Wider than the default \p BLOCK_SIZE of the serial
+/// decomposition, as each tile is a task: narrower tiles spend more time scheduling than updating.
+template < size_t TILE_SIZE = 64, typename MatrixT, typename PivotT, size_t BLOCK_SIZE >
+inline bool ParallelFactorize( LUDecomposition< MatrixT, PivotT, BLOCK_SIZE >& io_decomposition,
+                               const MatrixT&                                  i_matrix,
+                               TaskPool&                                       io_pool )
+{
+    return _ParallelFactorization::Factorize< TILE_SIZE >( i_matrix, io_pool, io_decomposition );
+}
+
+/// Factorize \p i_matrix into the Cholesky decomposition \p io_decomposition in parallel on \p io_pool, replacing
+/// its current decomposition.
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The results do not depend on the number of threads.
+///
+/// \param io_decomposition the decomposition to replace.
+/// \param i_matrix the symmetric matrix to decompose.
+/// \param io_pool the pool of threads executing the tasks.
+///
+/// \return \p true if \p i_matrix is positive definite.  \p false otherwise, in which case the decomposition is
+/// not usable.
+///
+/// \tparam TILE_SIZE the number of rows and columns per tile.
+template < size_t TILE_SIZE = 64, typename MatrixT >
+inline bool
+ParallelFactorize( CholeskyDecomposition< MatrixT >& io_decomposition, const MatrixT& i_matrix, TaskPool& io_pool )
+{
+    return _ParallelFactorization::Factorize< TILE_SIZE >( i_matrix, io_pool, io_decomposition );
+}
+
+LINEAR_NS_CLOSE
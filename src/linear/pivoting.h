@@ -0,0 +1,100 @@
+#pragma once
+
+/// \file pivoting.h
+/// \ingroup LinearAlgebra_Types
+///
+/// Pivoting policies.
+///
+/// Elimination-based operations take a pivoting policy as their first template parameter, which selects the
+/// row to be exchanged into the pivot position at each elimination step:
+/// \code{.cpp}
+/// linear::Inverse< linear::PartialPivot >( matrix, inverse );
+/// \endcode
+///
+/// A policy provides a static \p FindPivotRow function, which returns the index of the row which should become
+/// the pivot row, or \p -1 if no usable pivot exists in the column.  \ref NoPivot is the exception: elimination
+/// skips the search and exchange entirely at compile-time.
+
+#include <linear/linear.h>
+
+#include <cmath>
+#include <type_traits>
+
+LINEAR_NS_OPEN
+
+/// \struct NoPivot
+/// \ingroup LinearAlgebra_Types
+///
+/// Pivoting policy which never exchanges rows, thus elimination skips the pivot search and row exchange at
+/// compile-time.
+///
+/// Suitable for matrices known to be non-singular without pivoting, such as diagonally dominant or symmetric
+/// positive definite matrices, for \ref Inverse, \ref Determinant, \ref Solve and \ref LUDecomposition.  A zero
+/// pivot is still reported as singular, even if a row exchange would produce a usable pivot.
+///
+/// Operations which reveal the rank, such as \ref Rank and \ref RowEchelonForm, reject this policy, as a column
+/// without a pivot in place does not imply a dependent column.
+struct NoPivot
+{
+};
+
+/// Check if the pivoting policy \p PivotT searches for, and exchanges, pivot rows.
+template < typename PivotT >
+constexpr bool _ExchangesRows()
+{
+    return !std::is_same< PivotT, NoPivot >::value;
+}
+
+/// \struct ZeroPivot
+/// \ingroup LinearAlgebra_Types
+///
+/// Pivoting policy which only exchanges rows when the pivot is exactly zero, selecting the first row below
+/// with a non-zero co-efficient.  This is the default policy.
+struct ZeroPivot
+{
+    template < typename MatrixT >
+    static inline int FindPivotRow( int i_pivotRowIndex, int i_pivotColIndex, const MatrixT& i_matrix )
+    {
+        for ( int rowIndex = i_pivotRowIndex; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            if ( i_matrix( rowIndex, i_pivotColIndex ) != 0 )
+            {
+                return rowIndex;
+            }
+        }
+
+        return -1;
+    }
+};
+
+/// \struct PartialPivot
+/// \ingroup LinearAlgebra_Types
+///
+/// Pivoting policy which selects the row with the largest absolute co-efficient, at or below the pivot row.
+///
+/// Keeps the magnitude of the elimination factors at most 1, improving numerical accuracy when a pivot is
+/// small rather than exactly zero.
+struct PartialPivot
+{
+    template < typename MatrixT >
+    static inline int FindPivotRow( int i_pivotRowIndex, int i_pivotColIndex, const MatrixT& i_matrix )
+    {
+        using ValueT = typename MatrixT::ValueType;
+
+        int    maximumRow      = i_pivotRowIndex;
+        ValueT maximumAbsolute = std::abs( i_matrix( i_pivotRowIndex, i_pivotColIndex ) );
+        for ( int rowIndex = i_pivotRowIndex + 1; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            ValueT absolute = std::abs( i_matrix( rowIndex, i_pivotColIndex ) );
+            if ( absolute > maximumAbsolute )
+            {
+                maximumAbsolute = absolute;
+                maximumRow      = rowIndex;
+            }
+        }
+
+        return maximumAbsolute != 0 ? maximumRow : -1;
+    }
+};
+
+LINEAR_NS_CLOSE
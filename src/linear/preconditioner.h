@@ -0,0 +1,419 @@
+#pragma once
+
+/// \file preconditioner.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Preconditioners for the iterative solvers.
+///
+/// A preconditioner \f$M\f$ approximates the system matrix \f$A\f$, such that \f$M^{-1}A\f$ is much better conditioned
+/// than \f$A\f$, while \f$M^{-1}\f$ remains cheap to apply.  Like an operator, a preconditioner provides
+/// \code{.cpp}
+/// void Apply( const VectorT& i_x, VectorT& o_y ) const; // y = M^-1 * x
+/// \endcode
+/// so that a \ref Matrix holding an approximate inverse may also be used as a preconditioner.
+///
+/// A preconditioner is computed from the system matrix by \p Setup, then re-used across any number of solves.  Setup
+/// fails on a zero diagonal, a singular block, or a breakdown of an incomplete factorization, thus there is no
+/// constructor from the system matrix which would leave such a failure unchecked:
+/// \code{.cpp}
+/// linear::JacobiPreconditioner< MatrixT > preconditioner;
+/// if ( !preconditioner.Setup( matrix ) ) { ... }
+/// \endcode
+/// The incomplete factorizations further split the setup into the analysis of the sparsity pattern, and the numeric
+/// factorization which may be repeated for any matrix sharing the pattern.
+
+#include <linear/inverse.h>
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixIncompleteFactorization.h>
+
+#include <array>
+
+LINEAR_NS_OPEN
+
+/// \class IdentityPreconditioner
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The trivial preconditioner \f$M = I\f$, which leaves a solver un-preconditioned.
+///
+/// \tparam VectorT the column vector type.
+template < typename VectorT >
+class IdentityPreconditioner final
+{
+public:
+    /// Apply the preconditioner: \f$y = x\f$.
+    inline void Apply( const VectorT& i_x, VectorT& o_y ) const
+    {
+        o_y = i_x;
+    }
+};
+
+/// \class JacobiPreconditioner
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The Jacobi preconditioner \f$M = diag(A)\f$, which corrects for badly scaled rows at the cost of a single
+/// multiplication per entry.
+///
+/// \tparam MatrixT the type of the square system matrix.
+template < typename MatrixT >
+class JacobiPreconditioner final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the vectors to precondition.
+    using VectorType = Matrix< MatrixT::RowCount(), 1, ValueType >;
+
+    /// Default constructor.  The preconditioner must be set up by \p Setup before it is applied, checking its result.
+    JacobiPreconditioner() = default;
+
+    /// Set up the preconditioner of \p i_matrix.
+    ///
+    /// \param i_matrix the system matrix.
+    ///
+    /// \return \p false if a diagonal entry of \p i_matrix is zero.
+    bool Setup( const MatrixT& i_matrix )
+    {
+        for ( int index = 0; index < MatrixT::RowCount(); ++index )
+        {
+            if ( i_matrix( index, index ) == 0 )
+            {
+                return false;
+            }
+            m_inverseDiagonal[ index ] = 1 / i_matrix( index, index );
+        }
+
+        return true;
+    }
+
+    /// Apply the preconditioner: \f$y = M^{-1}x\f$.
+    inline void Apply( const VectorType& i_x, VectorType& o_y ) const
+    {
+        for ( int index = 0; index < MatrixT::RowCount(); ++index )
+        {
+            o_y[ index ] = m_inverseDiagonal[ index ] * i_x[ index ];
+        }
+    }
+
+private:
+    VectorType m_inverseDiagonal;
+};
+
+/// \class BlockJacobiPreconditioner
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The block Jacobi preconditioner, whose \f$M\f$ is the block diagonal of \f$A\f$, with blocks of \p BLOCK_SIZE
+/// rows and columns.  It captures the coupling between the unknowns of each block, such as the components of a
+/// vector-valued unknown, at the cost of a small matrix product per block.
+///
+/// \tparam MatrixT the type of the square system matrix.
+/// \tparam BLOCK_SIZE the size of the diagonal blocks, which must divide the size of the system.
+template < typename MatrixT, int BLOCK_SIZE >
+class BlockJacobiPreconditioner final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    static_assert( BLOCK_SIZE > 0 && MatrixT::RowCount() % BLOCK_SIZE == 0 );
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the vectors to precondition.
+    using VectorType = Matrix< MatrixT::RowCount(), 1, ValueType >;
+
+    /// \var BlockType
+    ///
+    /// The type of a diagonal block.
+    using BlockType = Matrix< BLOCK_SIZE, BLOCK_SIZE, ValueType >;
+
+    /// Default constructor.  The preconditioner must be set up by \p Setup before it is applied, checking its result.
+    BlockJacobiPreconditioner() = default;
+
+    /// Set up the preconditioner of \p i_matrix, by inverting each of its diagonal blocks.
+    ///
+    /// \param i_matrix the system matrix.
+    ///
+    /// \return \p false if a diagonal block of \p i_matrix is singular.
+    bool Setup( const MatrixT& i_matrix )
+    {
+        for ( int blockIndex = 0; blockIndex < BLOCK_COUNT; ++blockIndex )
+        {
+            const int offset = blockIndex * BLOCK_SIZE;
+            BlockType block;
+            for ( int rowIndex = 0; rowIndex < BLOCK_SIZE; ++rowIndex )
+            {
+                for ( int columnIndex = 0; columnIndex < BLOCK_SIZE; ++columnIndex )
+                {
+                    block( rowIndex, columnIndex ) = i_matrix( offset + rowIndex, offset + columnIndex );
+                }
+            }
+
+            if ( !Inverse( block, m_inverseBlocks[ blockIndex ] ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Apply the preconditioner: \f$y = M^{-1}x\f$.
+    inline void Apply( const VectorType& i_x, VectorType& o_y ) const
+    {
+        for ( int blockIndex = 0; blockIndex < BLOCK_COUNT; ++blockIndex )
+        {
+            const int        offset       = blockIndex * BLOCK_SIZE;
+            const BlockType& inverseBlock = m_inverseBlocks[ blockIndex ];
+            for ( int rowIndex = 0; rowIndex < BLOCK_SIZE; ++rowIndex )
+            {
+                o_y[ offset + rowIndex ] = _DotProduct( &inverseBlock( rowIndex, 0 ), &i_x[ offset ], BLOCK_SIZE );
+            }
+        }
+    }
+
+private:
+    static constexpr int BLOCK_COUNT = MatrixT::RowCount() / BLOCK_SIZE;
+
+    std::array< BlockType, BLOCK_COUNT > m_inverseBlocks;
+};
+
+/// \class IncompleteLUPreconditioner
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The incomplete LU preconditioner ILU(0), whose \f$M = LU\f$ is the LU decomposition of \f$A\f$ restricted to the
+/// sparsity pattern of \f$A\f$.  Both its factorization and application only visit the non-zero entries.
+///
+/// \code{.cpp}
+/// linear::IncompleteLUPreconditioner< MatrixT > preconditioner;
+/// preconditioner.AnalyzePattern( matrices[ 0 ] );
+/// for ( const MatrixT& matrix : matrices ) // Sharing the same pattern.
+/// {
+///     preconditioner.Factorize( matrix );
+///     solver.Solve( matrix, preconditioner, rhs, solution );
+/// }
+/// \endcode
+///
+/// \tparam MatrixT the type of the square system matrix.
+template < typename MatrixT >
+class IncompleteLUPreconditioner final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the vectors to precondition.
+    using VectorType = Matrix< MatrixT::RowCount(), 1, ValueType >;
+
+    /// Default constructor.  The preconditioner must be set up by \p Setup before it is applied, checking its result.
+    IncompleteLUPreconditioner() = default;
+
+    /// Set up the preconditioner of \p i_matrix, analyzing its pattern then factoring it.
+    ///
+    /// \param i_matrix the system matrix.
+    ///
+    /// \return \p false if the incomplete factorization encountered a zero pivot.
+    bool Setup( const MatrixT& i_matrix )
+    {
+        AnalyzePattern( i_matrix );
+        return Factorize( i_matrix );
+    }
+
+    /// Record the sparsity pattern of \p i_matrix, for subsequent factorizations.
+    ///
+    /// \param i_matrix a matrix with the sparsity pattern of the system matrices.
+    void AnalyzePattern( const MatrixT& i_matrix )
+    {
+        m_pattern.Analyze( i_matrix );
+        m_factor = FactorType();
+    }
+
+    /// Factor \p i_matrix, whose entries outside of the analyzed pattern are ignored.
+    ///
+    /// \param i_matrix the system matrix.
+    ///
+    /// \return \p false if the incomplete factorization encountered a zero pivot.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            const int rowBegin = m_pattern.m_rowOffsets[ rowIndex ];
+            const int rowEnd   = m_pattern.m_rowOffsets[ rowIndex + 1 ];
+            for ( int offset = rowBegin; offset < rowEnd; ++offset )
+            {
+                const int columnIndex            = m_pattern.m_columnIndices[ offset ];
+                m_factor( rowIndex, columnIndex ) = i_matrix( rowIndex, columnIndex );
+            }
+        }
+
+        return _MatrixIncompleteLU( m_pattern, m_factor );
+    }
+
+    /// Apply the preconditioner: \f$y = (LU)^{-1}x\f$, via forward then backward substitution.
+    void Apply( const VectorType& i_x, VectorType& o_y ) const
+    {
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            const int rowBegin       = m_pattern.m_rowOffsets[ rowIndex ];
+            const int diagonalOffset = m_pattern.m_diagonalOffsets[ rowIndex ];
+            ValueType value          = i_x[ rowIndex ];
+            for ( int offset = rowBegin; offset < diagonalOffset; ++offset )
+            {
+                const int columnIndex = m_pattern.m_columnIndices[ offset ];
+                value -= m_factor( rowIndex, columnIndex ) * o_y[ columnIndex ];
+            }
+            o_y[ rowIndex ] = value;
+        }
+
+        for ( int rowIndex = N - 1; rowIndex >= 0; --rowIndex )
+        {
+            const int diagonalOffset = m_pattern.m_diagonalOffsets[ rowIndex ];
+            const int rowEnd         = m_pattern.m_rowOffsets[ rowIndex + 1 ];
+            ValueType value          = o_y[ rowIndex ];
+            for ( int offset = diagonalOffset + 1; offset < rowEnd; ++offset )
+            {
+                const int columnIndex = m_pattern.m_columnIndices[ offset ];
+                value -= m_factor( rowIndex, columnIndex ) * o_y[ columnIndex ];
+            }
+            o_y[ rowIndex ] = value / m_factor( rowIndex, rowIndex );
+        }
+    }
+
+private:
+    static constexpr int N = MatrixT::RowCount();
+
+    /// The factors, whose entries outside of the pattern remain zero.
+    using FactorType = Matrix< N, N, ValueType >;
+    _SparsityPattern< N > m_pattern;
+    FactorType            m_factor;
+};
+
+/// \class IncompleteCholeskyPreconditioner
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The incomplete Cholesky preconditioner IC(0), whose \f$M = LL^T\f$ is the Cholesky decomposition of the symmetric
+/// positive definite \f$A\f$ restricted to the sparsity pattern of \f$A\f$.  It preserves the symmetry of the system,
+/// as required by \ref ConjugateGradient, and is used as \ref IncompleteLUPreconditioner.
+///
+/// \tparam MatrixT the type of the square system matrix.
+template < typename MatrixT >
+class IncompleteCholeskyPreconditioner final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the vectors to precondition.
+    using VectorType = Matrix< MatrixT::RowCount(), 1, ValueType >;
+
+    /// Default constructor.  The preconditioner must be set up by \p Setup before it is applied, checking its result.
+    IncompleteCholeskyPreconditioner() = default;
+
+    /// Set up the preconditioner of \p i_matrix, analyzing its pattern then factoring it.
+    ///
+    /// \param i_matrix the symmetric system matrix.
+    ///
+    /// \return \p false if the incomplete factorization broke down on a non-positive pivot.
+    bool Setup( const MatrixT& i_matrix )
+    {
+        AnalyzePattern( i_matrix );
+        return Factorize( i_matrix );
+    }
+
+    /// Record the sparsity pattern of \p i_matrix, for subsequent factorizations.
+    ///
+    /// \param i_matrix a matrix with the sparsity pattern of the system matrices.
+    void AnalyzePattern( const MatrixT& i_matrix )
+    {
+        m_pattern.Analyze( i_matrix );
+        m_factor = FactorType();
+    }
+
+    /// Factor \p i_matrix, of which only the lower triangle is read, and whose entries outside of the analyzed
+    /// pattern are ignored.
+    ///
+    /// \param i_matrix the symmetric system matrix.
+    ///
+    /// \return \p false if the incomplete factorization broke down on a non-positive pivot.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            const int rowBegin       = m_pattern.m_rowOffsets[ rowIndex ];
+            const int diagonalOffset = m_pattern.m_diagonalOffsets[ rowIndex ];
+            for ( int offset = rowBegin; offset <= diagonalOffset; ++offset )
+            {
+                const int columnIndex            = m_pattern.m_columnIndices[ offset ];
+                m_factor( rowIndex, columnIndex ) = i_matrix( rowIndex, columnIndex );
+            }
+        }
+
+        return _MatrixIncompleteCholesky( m_pattern, m_factor );
+    }
+
+    /// Apply the preconditioner: \f$y = (LL^T)^{-1}x\f$, via forward then backward substitution.
+    void Apply( const VectorType& i_x, VectorType& o_y ) const
+    {
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            const int rowBegin       = m_pattern.m_rowOffsets[ rowIndex ];
+            const int diagonalOffset = m_pattern.m_diagonalOffsets[ rowIndex ];
+            ValueType value          = i_x[ rowIndex ];
+            for ( int offset = rowBegin; offset < diagonalOffset; ++offset )
+            {
+                const int columnIndex = m_pattern.m_columnIndices[ offset ];
+                value -= m_factor( rowIndex, columnIndex ) * o_y[ columnIndex ];
+            }
+            o_y[ rowIndex ] = value / m_factor( rowIndex, rowIndex );
+        }
+
+        // L^T is traversed by the rows of L, scattering each solved entry to the entries above it.
+        for ( int rowIndex = N - 1; rowIndex >= 0; --rowIndex )
+        {
+            o_y[ rowIndex ] /= m_factor( rowIndex, rowIndex );
+
+            const ValueType value          = o_y[ rowIndex ];
+            const int       rowBegin       = m_pattern.m_rowOffsets[ rowIndex ];
+            const int       diagonalOffset = m_pattern.m_diagonalOffsets[ rowIndex ];
+            for ( int offset = rowBegin; offset < diagonalOffset; ++offset )
+            {
+                const int columnIndex = m_pattern.m_columnIndices[ offset ];
+                o_y[ columnIndex ] -= m_factor( rowIndex, columnIndex ) * value;
+            }
+        }
+    }
+
+private:
+    static constexpr int N = MatrixT::RowCount();
+
+    /// The lower triangular factor, whose entries outside of the pattern remain zero.
+    using FactorType = Matrix< N, N, ValueType >;
+    _SparsityPattern< N > m_pattern;
+    FactorType            m_factor;
+};
+
+LINEAR_NS_CLOSE
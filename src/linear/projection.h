@@ -17,17 +17,226 @@
 /// P = A(A^TA)^-1A^T
 /// \f]
 
-#include <linear/inverse.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
-#include <linear/multiply.h>
+#include <linear/qrDecomposition.h>
+#include <linear/rank.h>
+#include <linear/singularValueDecomposition.h>
 #include <linear/transpose.h>
 
+#include <linear/base/matrixElimination.h>
+
+#include <array>
+#include <cstddef>
+
 LINEAR_NS_OPEN
 
+/// \class Projector
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Projection onto the subspace spanned by the column-space of a matrix \f$A\f$, factored once and re-used across
+/// many vectors:
+/// \code{.cpp}
+/// linear::Projector< linear::Matrix< 3, 2 > > projector( subspace );
+/// for ( linear::Matrix< 3, 1 >& vector : vectors )
+/// {
+///     vector = projector.Project( vector );
+/// }
+/// \endcode
+///
+/// The subspace is stored as an orthonormal basis \f$Q\f$, the thin orthogonal factor of the QR decomposition of
+/// \f$A\f$, such that
+/// \f[
+/// P = A(A^TA)^{-1}A^T = QQ^T
+/// \f]
+/// so each projection is two thin matrix products, without forming \f$A^TA\f$ nor inverting it.  If the columns of
+/// \f$A\f$ are dependent, the basis is instead formed by the left singular vectors of its non-zero singular values.
+///
+/// \tparam MatrixT the type of the matrix whose column-space spans the subspace.
+template < typename MatrixT >
+class Projector final
+{
+public:
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var VectorType
+    ///
+    /// The type of the vectors to project.
+    using VectorType = Matrix< MatrixT::RowCount(), 1, ValueType >;
+
+    /// \var ProjectionMatrixType
+    ///
+    /// The type of the projection matrix.
+    using ProjectionMatrixType = Matrix< MatrixT::RowCount(), MatrixT::RowCount(), ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, projecting onto the empty subspace.
+    Projector() = default;
+
+    /// Construct the projector onto the column-space of \p i_matrix.
+    ///
+    /// \param i_matrix the matrix whose column-space spans the subspace.
+    explicit Projector( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current subspace.
+    ///
+    /// \param i_matrix the matrix whose column-space spans the subspace.
+    void Factorize( const MatrixT& i_matrix )
+    {
+        using MatrixType = typename MatrixT::MatrixType;
+
+        if constexpr ( MatrixT::RowCount() >= MatrixT::ColumnCount() )
+        {
+            QRDecomposition< MatrixType > qr;
+            if ( qr.Factorize( i_matrix ) )
+            {
+                m_basisRows = Transpose( qr.Q() );
+                m_rank      = MatrixT::ColumnCount();
+                return;
+            }
+        }
+
+        SingularValueDecomposition< MatrixType > svd( i_matrix );
+        m_basisRows = BasisRowsType();
+        m_rank      = svd.Rank();
+        for ( int index = 0; index < m_rank; ++index )
+        {
+            for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+            {
+                m_basisRows( index, rowIndex ) = svd.U()( rowIndex, index );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Get the dimension of the subspace.
+    ///
+    /// \return the rank of the factored matrix.
+    inline int Rank() const
+    {
+        return m_rank;
+    }
+
+    /// Project each column of \p i_vectors onto the subspace, as \f$Q(Q^TB)\f$.
+    ///
+    /// \param i_vectors a single column vector, or a matrix whose columns are many vectors.
+    ///
+    /// \return the projections.
+    template < typename VectorsT >
+    typename VectorsT::MatrixType Project( const VectorsT& i_vectors ) const
+    {
+        static_assert( VectorsT::RowCount() == MatrixT::RowCount() );
+        constexpr int COUNT = VectorsT::ColumnCount();
+
+        // Binds directly to a Matrix, or materializes a matrix view.
+        const typename VectorsT::MatrixType& vectors = i_vectors;
+
+        // Q^T * B, then Q * (Q^T * B), both accumulated one row at a time.
+        Matrix< MAX_RANK, COUNT, ValueType > coordinates;
+        for ( int index = 0; index < m_rank; ++index )
+        {
+            for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+            {
+                _EliminateRow(
+                    &vectors( rowIndex, 0 ), -m_basisRows( index, rowIndex ), 0, COUNT, &coordinates( index, 0 ) );
+            }
+        }
+
+        typename VectorsT::MatrixType projections;
+        for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            for ( int index = 0; index < m_rank; ++index )
+            {
+                _EliminateRow(
+                    &coordinates( index, 0 ), -m_basisRows( index, rowIndex ), 0, COUNT, &projections( rowIndex, 0 ) );
+            }
+        }
+
+        return projections;
+    }
+
+    /// Project a batch of \p i_count vectors onto the subspace.
+    ///
+    /// \p i_vectors and \p o_projections may refer to the same array.
+    ///
+    /// \param i_vectors the array of vectors to project.
+    /// \param i_count the number of vectors.
+    /// \param o_projections the array of projections.
+    void Project( const VectorType* i_vectors, size_t i_count, VectorType* o_projections ) const
+    {
+        for ( size_t vectorIndex = 0; vectorIndex < i_count; ++vectorIndex )
+        {
+            // The coordinates within the basis, as dot products over the contiguous basis rows.
+            std::array< ValueType, MAX_RANK > coordinates;
+            for ( int index = 0; index < m_rank; ++index )
+            {
+                coordinates[ index ] =
+                    _DotProduct( &m_basisRows( index, 0 ), &i_vectors[ vectorIndex ][ 0 ], MatrixT::RowCount() );
+            }
+
+            VectorType projection;
+            for ( int index = 0; index < m_rank; ++index )
+            {
+                _EliminateRow(
+                    &m_basisRows( index, 0 ), -coordinates[ index ], 0, MatrixT::RowCount(), &projection[ 0 ] );
+            }
+            o_projections[ vectorIndex ] = projection;
+        }
+    }
+
+    /// Form the projection matrix \f$P = QQ^T\f$.
+    ///
+    /// \return the projection matrix.
+    ProjectionMatrixType ProjectionMatrix() const
+    {
+        ProjectionMatrixType projection;
+        for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            for ( int index = 0; index < m_rank; ++index )
+            {
+                _EliminateRow( &m_basisRows( index, 0 ),
+                               -m_basisRows( index, rowIndex ),
+                               0,
+                               MatrixT::RowCount(),
+                               &projection( rowIndex, 0 ) );
+            }
+        }
+        return projection;
+    }
+
+private:
+    /// The maximum dimension of the subspace.
+    static constexpr int MAX_RANK = MaxRank< MatrixT >();
+
+    /// The orthonormal basis of the subspace, as rows, such that the dot products and updates run over contiguous
+    /// entries.  Only the leading m_rank rows are used.
+    using BasisRowsType = Matrix< MAX_RANK, MatrixT::RowCount(), ValueType >;
+    BasisRowsType m_basisRows;
+
+    int m_rank = 0;
+};
+
 /// Compute the projection matrix of a subspace, spanned by the column-space of input matrix \p i_matrix.
 /// \ingroup LinearAlgebra_Operations
 ///
+/// To project many vectors onto the same subspace, factor it once into a \ref Projector instead.
+///
 /// \param i_matrix The matrix whose column-space spans the sub-space to project onto.
 ///
 /// \return The projection matrix.
@@ -35,33 +244,22 @@ template < typename MatrixT >
 inline Matrix< MatrixT::RowCount(), MatrixT::RowCount(), typename MatrixT::ValueType >
 ProjectionMatrix( const MatrixT& i_matrix )
 {
-    // A Transpose
-    using TransposeMatrixT      = Matrix< MatrixT::ColumnCount(), MatrixT::RowCount(), typename MatrixT::ValueType >;
-    TransposeMatrixT aTranspose = Transpose( i_matrix );
-
-    // A^T * A term.
-    using ATAMatrixT       = Matrix< MatrixT::ColumnCount(), MatrixT::ColumnCount(), typename MatrixT::ValueType >;
-    ATAMatrixT aTransposeA = Multiply( aTranspose, i_matrix );
-
-    // (A^T * A)^-1
-    ATAMatrixT aTransposeAInverse;
-    LINEAR_VERIFY( Inverse( aTransposeA, aTransposeAInverse ) );
-
-    // A * (A^T * A)^-1 * A^T
-    return Multiply( Multiply( i_matrix, aTransposeAInverse ), aTranspose );
+    return Projector< typename MatrixT::MatrixType >( i_matrix ).ProjectionMatrix();
 }
 
 /// Compute the projection of a vector onto a subspace.
 /// \ingroup LinearAlgebra_Operations
 ///
+/// To project many vectors onto the same subspace, factor it once into a \ref Projector instead.
+///
 /// \param i_vector The column vector to project onto the sub-space.
 /// \param i_matrix The matrix whose column-space spans the sub-space to project onto.
 ///
-/// \return \p true if i_matrix is invertible. \p false if \p i_matrix is singular (thus cannot be inverted).
+/// \return the projection of the vector.
 template < typename VectorT, typename MatrixT >
-inline VectorT Projection( const VectorT& i_vector, const MatrixT& i_matrix )
+inline typename VectorT::MatrixType Projection( const VectorT& i_vector, const MatrixT& i_matrix )
 {
-    return Multiply( ProjectionMatrix( i_matrix ), i_vector );
+    return Projector< typename MatrixT::MatrixType >( i_matrix ).Project( i_vector );
 }
 
 LINEAR_NS_CLOSE
@@ -0,0 +1,241 @@
+#pragma once
+
+/// \file qrDecomposition.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// QR decomposition.
+///
+/// A matrix \f$A\f$ with at least as many rows as columns is factored into
+/// \f[
+/// A = QR
+/// \f]
+/// where \f$Q\f$ is orthogonal and \f$R\f$ is upper triangular.
+///
+/// \f$Q\f$ is represented compactly as the product of Householder reflectors \f$H_0 H_1 ... H_{n-1}\f$, and is
+/// only formed explicitly on request.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixHouseholder.h>
+#include <linear/base/matrixTriangularSolve.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+LINEAR_NS_OPEN
+
+/// \class QRDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The Householder QR decomposition of a matrix, computed once and reusable across many operations, such as
+/// solving least squares problems:
+/// \code{.cpp}
+/// linear::QRDecomposition< linear::Matrix< 4, 2 > > qr( matrix );
+/// linear::Matrix< 2, 1 > x;
+/// qr.SolveLeastSquares( b, x );
+/// \endcode
+///
+/// \tparam MatrixT the type of the matrix to decompose, with at least as many rows as columns.
+/// \tparam BLOCK_SIZE the number of columns factored as a panel, before being applied as a block onto the
+/// trailing columns.
+template < typename MatrixT, size_t BLOCK_SIZE = 32 >
+class QRDecomposition final
+{
+public:
+    static_assert( MatrixT::RowCount() >= MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix, and of the thin \f$Q\f$ factor.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    /// \var RMatrixType
+    ///
+    /// The type of the square upper triangular factor \f$R\f$.
+    using RMatrixType = Matrix< MatrixT::ColumnCount(), MatrixT::ColumnCount(), ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    QRDecomposition() = default;
+
+    /// Construct the QR decomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    explicit QRDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    ///
+    /// \return \p true if the columns of \p i_matrix are numerically independent, thus \f$R\f$ is invertible.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        m_qr = i_matrix;
+        _MatrixHouseholderQR< BLOCK_SIZE >( m_qr, m_tau );
+
+        // A diagonal entry of R which is negligible relative to the largest is treated as zero, as rounding
+        // errors prevent dependent columns from producing exact zeroes.
+        ValueType maximumDiagonal = 0;
+        for ( int columnIndex = 0; columnIndex < MatrixType::ColumnCount(); ++columnIndex )
+        {
+            maximumDiagonal = std::max( maximumDiagonal, std::abs( m_qr( columnIndex, columnIndex ) ) );
+        }
+
+        const ValueType threshold =
+            maximumDiagonal * MatrixType::RowCount() * std::numeric_limits< ValueType >::epsilon();
+        m_hasFullRank = maximumDiagonal > 0;
+        for ( int columnIndex = 0; columnIndex < MatrixType::ColumnCount(); ++columnIndex )
+        {
+            if ( std::abs( m_qr( columnIndex, columnIndex ) ) <= threshold )
+            {
+                m_hasFullRank = false;
+                break;
+            }
+        }
+
+        return m_hasFullRank;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the columns of the decomposed matrix are independent.
+    ///
+    /// \return \p true if the decomposed matrix has full column rank.
+    inline bool HasFullRank() const
+    {
+        return m_hasFullRank;
+    }
+
+    /// Multiply \p io_matrix by \f$Q\f$ from the left, in-place.
+    ///
+    /// \param io_matrix the matrix to multiply, with as many rows as the decomposed matrix.
+    template < typename OtherMatrixT >
+    void ApplyQ( OtherMatrixT& io_matrix ) const
+    {
+        static_assert( OtherMatrixT::RowCount() == MatrixType::RowCount() );
+        for ( int reflectorIndex = MatrixType::ColumnCount() - 1; reflectorIndex >= 0; --reflectorIndex )
+        {
+            _ApplyHouseholderReflector(
+                m_qr, reflectorIndex, m_tau[ reflectorIndex ], 0, OtherMatrixT::ColumnCount(), io_matrix );
+        }
+    }
+
+    /// Multiply \p io_matrix by \f$Q^T\f$ from the left, in-place.
+    ///
+    /// \param io_matrix the matrix to multiply, with as many rows as the decomposed matrix.
+    template < typename OtherMatrixT >
+    void ApplyQT( OtherMatrixT& io_matrix ) const
+    {
+        static_assert( OtherMatrixT::RowCount() == MatrixType::RowCount() );
+        for ( int reflectorIndex = 0; reflectorIndex < MatrixType::ColumnCount(); ++reflectorIndex )
+        {
+            _ApplyHouseholderReflector(
+                m_qr, reflectorIndex, m_tau[ reflectorIndex ], 0, OtherMatrixT::ColumnCount(), io_matrix );
+        }
+    }
+
+    /// Solve the least squares problem, finding \f$X\f$ which minimizes \f$||AX - B||\f$, where \f$A\f$ is the
+    /// decomposed matrix.
+    ///
+    /// \p i_rhs may be a single column vector \f$b\f$, or a matrix \f$B\f$ whose columns are many right-hand sides.
+    ///
+    /// \param i_rhs the right-hand side(s).
+    /// \param o_solution the least squares solution(s).
+    ///
+    /// \return \p true if the decomposed matrix has full column rank, thus the solution is unique.
+    template < typename RHST >
+    bool SolveLeastSquares( const RHST&                                                           i_rhs,
+                            Matrix< MatrixType::ColumnCount(), RHST::ColumnCount(), ValueType >& o_solution ) const
+    {
+        static_assert( RHST::RowCount() == MatrixType::RowCount() );
+        if ( !m_hasFullRank )
+        {
+            return false;
+        }
+
+        // Q^T * B
+        typename RHST::MatrixType rhs = i_rhs;
+        ApplyQT( rhs );
+
+        // R * X = (Q^T * B), for the leading rows.
+        for ( int rowIndex = 0; rowIndex < MatrixType::ColumnCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex < RHST::ColumnCount(); ++columnIndex )
+            {
+                o_solution( rowIndex, columnIndex ) = rhs( rowIndex, columnIndex );
+            }
+        }
+
+        _UpperTriangularSolve( m_qr, o_solution );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Factors
+    //-------------------------------------------------------------------------
+
+    /// Form the thin orthogonal factor \f$Q\f$, whose orthonormal columns span the column space of the decomposed
+    /// matrix.
+    ///
+    /// \return the thin orthogonal factor.
+    MatrixType Q() const
+    {
+        MatrixType orthogonal;
+        for ( int columnIndex = 0; columnIndex < MatrixType::ColumnCount(); ++columnIndex )
+        {
+            orthogonal( columnIndex, columnIndex ) = 1;
+        }
+
+        ApplyQ( orthogonal );
+        return orthogonal;
+    }
+
+    /// Get the upper triangular factor \f$R\f$.
+    ///
+    /// \return the upper triangular factor.
+    RMatrixType R() const
+    {
+        RMatrixType upper;
+        for ( int rowIndex = 0; rowIndex < RMatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = rowIndex; columnIndex < RMatrixType::ColumnCount(); ++columnIndex )
+            {
+                upper( rowIndex, columnIndex ) = m_qr( rowIndex, columnIndex );
+            }
+        }
+        return upper;
+    }
+
+private:
+    /// Packed R factor and Householder reflector vectors.
+    MatrixType m_qr;
+
+    /// Scalar factors of the Householder reflectors.
+    std::array< ValueType, MatrixType::ColumnCount() > m_tau{};
+
+    /// Whether the decomposed matrix has full column rank.
+    bool m_hasFullRank = false;
+};
+
+LINEAR_NS_CLOSE
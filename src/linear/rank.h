@@ -7,13 +7,27 @@
 ///
 /// The \em rank of a matrix is the number of pivot columns it possesses, or in other words,
 /// the number of independent columns.
+///
+/// For matrices of floating point values, whose dependent columns rarely eliminate to exact zeroes, the
+/// \em numerical rank is computed against a tolerance.
+///
+/// Matrices of integral values are instead eliminated fraction-free, which keeps every intermediate an integer,
+/// such that the rank is exact.
 
+#include <linear/eliminationWorkspace.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/pivoting.h>
 
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixBareiss.h>
 #include <linear/base/matrixEntryArray.h>
+#include <linear/base/matrixPivotedQR.h>
 #include <linear/base/matrixRowEchelon.h>
 
+#include <array>
+#include <type_traits>
+
 LINEAR_NS_OPEN
 
 /// Compute the <em>maximum rank</em> a matrix of type \p MatrixT could potentially have.
@@ -28,20 +42,137 @@ constexpr inline size_t MaxRank()
     return std::min( MatrixT::RowCount(), MatrixT::ColumnCount() );
 }
 
+/// Compute the exact \em rank of matrix \p i_matrix of integral values via fraction-free (Bareiss) elimination, in
+/// \f$O(mn \min(m, n))\f$ integer operations, detecting overflow.
+/// \ingroup LinearAlgebra_Operations
+///
+/// \param i_matrix the matrix.
+/// \param o_rank the rank of the matrix.
+///
+/// \return \p true if the rank was computed.  \p false if an intermediate minor overflows the value type, in which
+/// case \p o_rank is un-defined.
+template < typename MatrixT >
+inline bool TryRank( const MatrixT& i_matrix, size_t& o_rank )
+{
+    static_assert( std::is_integral< typename MatrixT::ValueType >::value );
+    typename MatrixT::MatrixType matrix       = i_matrix;
+    int                          rank         = 0;
+    int                          rowExchanges = 0;
+    const bool                   isExact      = _MatrixBareiss( matrix, rank, rowExchanges );
+    o_rank                                    = rank;
+    return isExact;
+}
+
 /// Compute the \em rank of matrix \p i_matrix.
 /// \ingroup LinearAlgebra_Operations
 ///
 /// The rank of a matrix is defined to be the number of its pivots, or independent columns.
 ///
+/// Matrices of integral values are eliminated fraction-free (Bareiss), in which case \p PivotT is un-used.  Should
+/// an intermediate minor overflow the value type, the result is un-defined; see \ref TryRank, which reports overflow.
+///
 /// \ingroup LinearAlgebra_Operations
 ///
 /// \return the rank of the matrix.
-template < typename MatrixT >
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
 inline size_t Rank( const MatrixT& i_matrix )
 {
-    MatrixEntryArray< MaxRank< MatrixT >(), typename MatrixT::ValueType > pivots;
-    _MatrixRowEchelonForm( i_matrix, pivots );
-    return pivots.Size();
+    if constexpr ( std::is_integral< typename MatrixT::ValueType >::value )
+    {
+        size_t rank = 0;
+        if ( !TryRank( i_matrix, rank ) )
+        {
+            LINEAR_ASSERT_MSG( false, "The rank computation overflows its value type.\n" );
+        }
+        return rank;
+    }
+    else
+    {
+        MatrixEntryArray< MaxRank< MatrixT >(), typename MatrixT::ValueType > pivots;
+        _MatrixRowEchelonForm< PivotT >( i_matrix, pivots );
+        return pivots.Size();
+    }
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the \em rank of matrix \p i_matrix, using the scratch memory of \p io_workspace instead of the stack.
+///
+/// \return the rank of the matrix.
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline size_t Rank( const MatrixT& i_matrix, EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
+{
+    io_workspace.WorkingMatrix() = i_matrix;
+    if constexpr ( std::is_integral< typename MatrixT::ValueType >::value )
+    {
+        int rank         = 0;
+        int rowExchanges = 0;
+        if ( !_MatrixBareiss( io_workspace.WorkingMatrix(), rank, rowExchanges ) )
+        {
+            LINEAR_ASSERT_MSG( false, "The rank computation overflows its value type.\n" );
+        }
+        return rank;
+    }
+    else
+    {
+        _MatrixRowEchelonForm< PivotT >( io_workspace.WorkingMatrix(),
+                                         io_workspace.EliminationFactors(),
+                                         io_workspace.Pivots() );
+        return io_workspace.Pivots().Size();
+    }
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the \em numerical rank of matrix \p i_matrix, as the number of columns which remain independent beyond
+/// \p i_tolerance.
+///
+/// The rank is revealed by a column pivoted QR decomposition, which factors the most independent remaining column
+/// at each step, and stops as soon as the norms of all the remaining columns are at or below \p i_tolerance.  A
+/// tolerance of \p 0 only treats exactly dependent columns as such.
+///
+/// The original indices of the independent columns are stored in the leading entries of \p o_pivotColumns, such
+/// that those columns of \p i_matrix form a basis of its column space.
+///
+/// \param i_matrix the matrix.
+/// \param i_tolerance the norm at or below which the remaining columns are treated as dependent.  A typical
+/// choice is \f$\max(m, n) \epsilon ||A||\f$.
+/// \param o_pivotColumns the indices of the independent columns.
+///
+/// \pre The values of \p i_matrix must be floating point.
+///
+/// \return the numerical rank of the matrix.
+template < typename MatrixT >
+inline size_t Rank( const MatrixT&                           i_matrix,
+                    const typename MatrixT::ValueType&       i_tolerance,
+                    std::array< int, MaxRank< MatrixT >() >& o_pivotColumns )
+{
+    static_assert( std::is_floating_point< typename MatrixT::ValueType >::value,
+                   "The numerical rank requires floating point values; use Rank( matrix ) for integral values." );
+    typename MatrixT::MatrixType matrix = i_matrix;
+    return _MatrixPivotedQR( matrix, i_tolerance, o_pivotColumns );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the \em numerical rank of matrix \p i_matrix, as the number of columns which remain independent beyond
+/// \p i_tolerance.
+///
+/// \return the numerical rank of the matrix.
+template < typename MatrixT >
+inline size_t Rank( const MatrixT& i_matrix, const typename MatrixT::ValueType& i_tolerance )
+{
+    static_assert( std::is_floating_point< typename MatrixT::ValueType >::value,
+                   "The numerical rank requires floating point values; use Rank( matrix ) for integral values." );
+    std::array< int, MaxRank< MatrixT >() > pivotColumns;
+    return Rank( i_matrix, i_tolerance, pivotColumns );
 }
 
 LINEAR_NS_CLOSE
@@ -7,6 +7,8 @@
 
 #include <linear/matrix.h>
 
+#include <utility>
+
 LINEAR_NS_OPEN
 
 /// Exchange rows of of a matrix, in-place.
@@ -24,11 +26,11 @@ void RowExchange( size_t i_rowIndexA, size_t i_rowIndexB, MatrixT& o_matrix )
     LINEAR_ASSERT( i_rowIndexB < MatrixT::RowCount() );
     LINEAR_ASSERT( i_rowIndexA != i_rowIndexB );
 
-    constexpr size_t         columnCount = MatrixT::ColumnCount();
-    Matrix< 1, columnCount > rowA        = o_matrix.GetRow( i_rowIndexA );
-
-    o_matrix.SetRow( i_rowIndexA, o_matrix.GetRow( i_rowIndexB ) );
-    o_matrix.SetRow( i_rowIndexB, rowA );
+    // Swap the entries in-place, without a temporary row of a possibly different value type.
+    for ( size_t columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+    {
+        std::swap( o_matrix( i_rowIndexA, columnIndex ), o_matrix( i_rowIndexB, columnIndex ) );
+    }
 }
 
 LINEAR_NS_CLOSE
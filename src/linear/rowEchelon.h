@@ -22,8 +22,10 @@
 
 #include <linear/base/matrixRowEchelon.h>
 
+#include <linear/eliminationWorkspace.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/pivoting.h>
 #include <linear/rank.h>
 
 LINEAR_NS_OPEN
@@ -34,11 +36,13 @@ LINEAR_NS_OPEN
 /// \param i_matrix the input matrix.
 ///
 /// \return the row echelon form of the input matrix.
-template < typename MatrixT >
-inline MatrixT RowEchelonForm( const MatrixT& i_matrix )
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline typename MatrixT::MatrixType RowEchelonForm( const MatrixT& i_matrix )
 {
     MatrixEntryArray< MaxRank< MatrixT >(), typename MatrixT::ValueType > pivots;
-    return _MatrixRowEchelonForm( i_matrix, pivots );
+    return _MatrixRowEchelonForm< PivotT >( i_matrix, pivots );
 }
 
 /// Compute the <em>reduced row echelon form</em> of a matrix, through elimination.
@@ -47,10 +51,56 @@ inline MatrixT RowEchelonForm( const MatrixT& i_matrix )
 /// \param i_matrix the input matrix.
 ///
 /// \return the reduced row echelon form of the input matrix.
-template < typename MatrixT >
-inline MatrixT ReducedRowEchelonForm( const MatrixT& i_matrix )
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline typename MatrixT::MatrixType ReducedRowEchelonForm( const MatrixT& i_matrix )
+{
+    return _MatrixReducedRowEchelonForm< PivotT >( i_matrix );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the <em>row echelon form</em> of a matrix into \p o_rowEchelonForm, using the scratch memory of
+/// \p io_workspace instead of the stack.
+///
+/// \param i_matrix the input matrix.
+/// \param o_rowEchelonForm the row echelon form of the input matrix.
+/// \param io_workspace reusable scratch memory.
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline void RowEchelonForm( const MatrixT&                                        i_matrix,
+                            typename MatrixT::MatrixType&                         o_rowEchelonForm,
+                            EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
+{
+    o_rowEchelonForm = i_matrix;
+    _MatrixRowEchelonForm< PivotT >( o_rowEchelonForm,
+                                     io_workspace.EliminationFactors(),
+                                     io_workspace.Pivots() );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Compute the <em>reduced row echelon form</em> of a matrix into \p o_reducedRowEchelonForm, using the scratch
+/// memory of \p io_workspace instead of the stack.
+///
+/// \param i_matrix the input matrix.
+/// \param o_reducedRowEchelonForm the reduced row echelon form of the input matrix.
+/// \param io_workspace reusable scratch memory.
+///
+/// \tparam PivotT the pivoting policy, which must exchange rows, thus not \ref NoPivot.
+template < typename PivotT = ZeroPivot, typename MatrixT >
+inline void ReducedRowEchelonForm( const MatrixT&                                        i_matrix,
+                                   typename MatrixT::MatrixType&                         o_reducedRowEchelonForm,
+                                   EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
 {
-    return _MatrixReducedRowEchelonForm( i_matrix );
+    o_reducedRowEchelonForm = i_matrix;
+    _MatrixReducedRowEchelonForm< PivotT >( o_reducedRowEchelonForm,
+                                            io_workspace.EliminationFactors(),
+                                            io_workspace.Pivots() );
 }
 
 LINEAR_NS_CLOSE
@@ -0,0 +1,332 @@
+#pragma once
+
+/// \file singularValueDecomposition.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Singular value decomposition.
+///
+/// Any \f$m \times n\f$ matrix \f$A\f$ is factored into
+/// \f[
+/// A = U \Sigma V^T
+/// \f]
+/// where the columns of \f$U\f$ and \f$V\f$ are orthonormal, and \f$\Sigma\f$ is diagonal with the non-negative
+/// singular values in descending order.  The \em thin factors keep \f$k = min(m, n)\f$ singular vectors, while the
+/// \em full factors complete them into square orthogonal matrices.
+///
+/// Unlike elimination, the singular values reveal the numerical rank of a matrix reliably, making the decomposition
+/// the tool of choice for rank-deficient or ill-conditioned problems: pseudo-inverses, minimum-norm least squares
+/// and low-rank approximations.
+///
+/// The decomposition is computed by one-sided Jacobi rotations, preceded by a QR decomposition for tall matrices.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+#include <linear/transpose.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixGramSchmidt.h>
+#include <linear/base/matrixSVD.h>
+
+#include <algorithm>
+#include <limits>
+
+LINEAR_NS_OPEN
+
+/// \class SingularValueDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The singular value decomposition of a matrix of any shape, computed once and reusable across many operations.
+///
+/// \tparam MatrixT the type of the matrix to decompose.
+template < typename MatrixT >
+class SingularValueDecomposition final
+{
+public:
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    /// \var SingularValuesType
+    ///
+    /// The column vector type of the singular values.
+    using SingularValuesType = Matrix< std::min( MatrixT::RowCount(), MatrixT::ColumnCount() ), 1, ValueType >;
+
+    /// \var UMatrixType
+    ///
+    /// The type of the thin left singular vectors.
+    using UMatrixType = Matrix< MatrixT::RowCount(), SingularValuesType::RowCount(), ValueType >;
+
+    /// \var VMatrixType
+    ///
+    /// The type of the thin right singular vectors.
+    using VMatrixType = Matrix< MatrixT::ColumnCount(), SingularValuesType::RowCount(), ValueType >;
+
+    /// \var PseudoInverseMatrixType
+    ///
+    /// The type of the pseudo-inverse, with the transposed shape of the decomposed matrix.
+    using PseudoInverseMatrixType = Matrix< MatrixT::ColumnCount(), MatrixT::RowCount(), ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    SingularValueDecomposition() = default;
+
+    /// Construct the singular value decomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    explicit SingularValueDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// \param i_matrix the matrix to decompose.
+    ///
+    /// \return \p true if the Jacobi iteration converged to machine precision.  The decomposition is usable either
+    /// way, but less accurate otherwise.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        // Wide matrices are decomposed through their transpose, swapping the roles of U and V.
+        if constexpr ( MatrixType::RowCount() >= MatrixType::ColumnCount() )
+        {
+            m_hasConverged =
+                _MatrixSVD< /* COMPUTE_VECTORS */ true >( MatrixType( i_matrix ), m_singularValues, m_u, m_v );
+        }
+        else
+        {
+            m_hasConverged = _MatrixSVD< /* COMPUTE_VECTORS */ true >( PseudoInverseMatrixType( Transpose( i_matrix ) ),
+                                                                      m_singularValues,
+                                                                      m_v,
+                                                                      m_u );
+        }
+        return m_hasConverged;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the Jacobi iteration converged to machine precision.
+    ///
+    /// \return \p true if the iteration converged.
+    inline bool HasConverged() const
+    {
+        return m_hasConverged;
+    }
+
+    /// Get the default tolerance below which singular values are treated as zero, scaled to the largest singular
+    /// value and the dimensions of the decomposed matrix.
+    ///
+    /// \return the default tolerance.
+    inline ValueType DefaultTolerance() const
+    {
+        return std::max( MatrixType::RowCount(), MatrixType::ColumnCount() ) *
+               std::numeric_limits< ValueType >::epsilon() * m_singularValues[ 0 ];
+    }
+
+    /// Compute the numerical rank of the decomposed matrix, as the number of singular values above \p i_tolerance.
+    ///
+    /// \param i_tolerance the tolerance below which singular values are treated as zero.
+    ///
+    /// \return the numerical rank.
+    int Rank( ValueType i_tolerance ) const
+    {
+        int rank = 0;
+        while ( rank < SingularValuesType::RowCount() && m_singularValues[ rank ] > i_tolerance )
+        {
+            ++rank;
+        }
+        return rank;
+    }
+
+    /// Compute the numerical rank of the decomposed matrix, with the \ref DefaultTolerance.
+    ///
+    /// \return the numerical rank.
+    inline int Rank() const
+    {
+        return Rank( DefaultTolerance() );
+    }
+
+    /// Compute the Moore-Penrose pseudo-inverse \f$A^+ = V \Sigma^+ U^T\f$ of the decomposed matrix, where singular
+    /// values at or below \p i_tolerance are treated as zero.
+    ///
+    /// \f$A^+b\f$ is the minimum-norm least squares solution of \f$Ax = b\f$, even if \f$A\f$ is rank-deficient.
+    ///
+    /// \param i_tolerance the tolerance below which singular values are treated as zero.
+    ///
+    /// \return the pseudo-inverse.
+    PseudoInverseMatrixType PseudoInverse( ValueType i_tolerance ) const
+    {
+        PseudoInverseMatrixType pseudoInverse;
+        const int               rank = Rank( i_tolerance );
+        for ( int index = 0; index < rank; ++index )
+        {
+            const ValueType singularValueReciprocal = 1 / m_singularValues[ index ];
+            for ( int rowIndex = 0; rowIndex < PseudoInverseMatrixType::RowCount(); ++rowIndex )
+            {
+                const ValueType factor = m_v( rowIndex, index ) * singularValueReciprocal;
+                for ( int columnIndex = 0; columnIndex < PseudoInverseMatrixType::ColumnCount(); ++columnIndex )
+                {
+                    pseudoInverse( rowIndex, columnIndex ) += factor * m_u( columnIndex, index );
+                }
+            }
+        }
+        return pseudoInverse;
+    }
+
+    /// Compute the Moore-Penrose pseudo-inverse with the \ref DefaultTolerance.
+    ///
+    /// \return the pseudo-inverse.
+    inline PseudoInverseMatrixType PseudoInverse() const
+    {
+        return PseudoInverse( DefaultTolerance() );
+    }
+
+    /// Compute the best approximation of the decomposed matrix, in both the 2-norm and Frobenius norm, whose rank
+    /// is at most \p i_rank, by keeping the \p i_rank largest singular values.
+    ///
+    /// \param i_rank the maximum rank of the approximation.
+    ///
+    /// \return the low-rank approximation.
+    MatrixType LowRankApproximation( int i_rank ) const
+    {
+        LINEAR_ASSERT( i_rank >= 0 && i_rank <= SingularValuesType::RowCount() );
+
+        MatrixType approximation;
+        for ( int index = 0; index < i_rank; ++index )
+        {
+            for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+            {
+                const ValueType factor = m_u( rowIndex, index ) * m_singularValues[ index ];
+                for ( int columnIndex = 0; columnIndex < MatrixType::ColumnCount(); ++columnIndex )
+                {
+                    approximation( rowIndex, columnIndex ) += factor * m_v( columnIndex, index );
+                }
+            }
+        }
+        return approximation;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Factors
+    //-------------------------------------------------------------------------
+
+    /// Get the singular values, in descending order.
+    ///
+    /// \return the singular values.
+    inline const SingularValuesType& SingularValues() const
+    {
+        return m_singularValues;
+    }
+
+    /// Get the thin left singular vectors, as the orthonormal columns of \f$U\f$.
+    ///
+    /// \return the thin left singular vectors.
+    inline const UMatrixType& U() const
+    {
+        return m_u;
+    }
+
+    /// Get the thin right singular vectors, as the orthonormal columns of \f$V\f$.
+    ///
+    /// \return the thin right singular vectors.
+    inline const VMatrixType& V() const
+    {
+        return m_v;
+    }
+
+    /// Form the full left singular vectors, completing the thin \f$U\f$ into a square orthogonal matrix.
+    ///
+    /// \return the full left singular vectors.
+    Matrix< MatrixType::RowCount(), MatrixType::RowCount(), ValueType > FullU() const
+    {
+        return _CompleteBasis( m_u );
+    }
+
+    /// Form the full right singular vectors, completing the thin \f$V\f$ into a square orthogonal matrix.
+    ///
+    /// \return the full right singular vectors.
+    Matrix< MatrixType::ColumnCount(), MatrixType::ColumnCount(), ValueType > FullV() const
+    {
+        return _CompleteBasis( m_v );
+    }
+
+private:
+    /// Complete the orthonormal columns of \p i_thin into a square orthogonal matrix.
+    template < typename ThinMatrixT >
+    static Matrix< ThinMatrixT::RowCount(), ThinMatrixT::RowCount(), ValueType >
+    _CompleteBasis( const ThinMatrixT& i_thin )
+    {
+        using FullMatrixT = Matrix< ThinMatrixT::RowCount(), ThinMatrixT::RowCount(), ValueType >;
+
+        FullMatrixT rows;
+        for ( int rowIndex = 0; rowIndex < ThinMatrixT::ColumnCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex < ThinMatrixT::RowCount(); ++columnIndex )
+            {
+                rows( rowIndex, columnIndex ) = i_thin( columnIndex, rowIndex );
+            }
+        }
+        _CompleteOrthonormalRows( ThinMatrixT::ColumnCount(), rows );
+        return FullMatrixT( Transpose( rows ) );
+    }
+
+    /// The singular values, in descending order.
+    SingularValuesType m_singularValues;
+
+    /// The thin left singular vectors.
+    UMatrixType m_u;
+
+    /// The thin right singular vectors.
+    VMatrixType m_v;
+
+    /// Whether the Jacobi iteration converged.
+    bool m_hasConverged = false;
+};
+
+/// Compute the singular values of \p i_matrix, in descending order.
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Skips the accumulation of the singular vectors, thus is cheaper than a full \ref SingularValueDecomposition.
+///
+/// \param i_matrix the input matrix.
+///
+/// \return the singular values.
+template < typename MatrixT >
+inline typename SingularValueDecomposition< MatrixT >::SingularValuesType SingularValues( const MatrixT& i_matrix )
+{
+    using SVDT = SingularValueDecomposition< MatrixT >;
+
+    typename SVDT::SingularValuesType singularValues;
+    if constexpr ( MatrixT::RowCount() >= MatrixT::ColumnCount() )
+    {
+        typename SVDT::UMatrixType u;
+        typename SVDT::VMatrixType v;
+        _MatrixSVD< /* COMPUTE_VECTORS */ false >( typename SVDT::MatrixType( i_matrix ), singularValues, u, v );
+    }
+    else
+    {
+        typename SVDT::VMatrixType u;
+        typename SVDT::UMatrixType v;
+        _MatrixSVD< /* COMPUTE_VECTORS */ false >( typename SVDT::PseudoInverseMatrixType( Transpose( i_matrix ) ),
+                                                    singularValues,
+                                                    u,
+                                                    v );
+    }
+    return singularValues;
+}
+
+LINEAR_NS_CLOSE
@@ -8,6 +8,7 @@
 #include <linear/base/matrixSlice.h>
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/sliceView.h>
 
 LINEAR_NS_OPEN
 
@@ -42,4 +43,86 @@ constexpr inline SliceT Slice( const SourceMatrixT& i_matrix )
     return _MatrixSlice< SourceMatrixT, SliceT, SLICE_ROW_BEGIN, SLICE_COLUMN_BEGIN >( i_matrix );
 }
 
+/// Get a \ref SliceView referencing a SLICE_ROWS x SLICE_COLUMNS block of \p i_matrix, whose upper-left
+/// entry is at (\p i_rowOffset, \p i_columnOffset).
+/// \ingroup LinearAlgebra_Operations
+///
+/// Unlike the compile-time variant of \ref Slice, the entries are not copied, and the offsets may be specified
+/// at runtime.  The view must not outlive \p i_matrix; blocks of temporaries are copied instead, see the rvalue
+/// overload.  Writes through the returned view modify \p i_matrix:
+/// \code{.cpp}
+/// linear::Matrix< 4, 4 > matrix;
+/// linear::Slice< 2, 2 >( matrix, 1, 1 ) = linear::Matrix< 2, 2 >::Identity();
+/// \endcode
+///
+/// \pre The block must reside within the bounds of \p i_matrix.
+///
+/// \return the slice view.
+template < size_t SLICE_ROWS, size_t SLICE_COLUMNS, size_t ROWS, size_t COLS, typename ValueT >
+inline SliceView< SLICE_ROWS, SLICE_COLUMNS, ValueT >
+Slice( Matrix< ROWS, COLS, ValueT >& i_matrix, size_t i_rowOffset, size_t i_columnOffset )
+{
+    static_assert( SLICE_ROWS <= ROWS );
+    static_assert( SLICE_COLUMNS <= COLS );
+    LINEAR_ASSERT( i_rowOffset + SLICE_ROWS <= ROWS );
+    LINEAR_ASSERT( i_columnOffset + SLICE_COLUMNS <= COLS );
+    return SliceView< SLICE_ROWS, SLICE_COLUMNS, ValueT >( &i_matrix( i_rowOffset, i_columnOffset ), COLS );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Get a read-only \ref SliceView referencing a block of a \em const matrix.
+template < size_t SLICE_ROWS, size_t SLICE_COLUMNS, size_t ROWS, size_t COLS, typename ValueT >
+inline SliceView< SLICE_ROWS, SLICE_COLUMNS, const ValueT >
+Slice( const Matrix< ROWS, COLS, ValueT >& i_matrix, size_t i_rowOffset, size_t i_columnOffset )
+{
+    static_assert( SLICE_ROWS <= ROWS );
+    static_assert( SLICE_COLUMNS <= COLS );
+    LINEAR_ASSERT( i_rowOffset + SLICE_ROWS <= ROWS );
+    LINEAR_ASSERT( i_columnOffset + SLICE_COLUMNS <= COLS );
+    return SliceView< SLICE_ROWS, SLICE_COLUMNS, const ValueT >( &i_matrix( i_rowOffset, i_columnOffset ), COLS );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Copy a SLICE_ROWS x SLICE_COLUMNS block of the temporary \p i_matrix.
+///
+/// A view of a temporary would dangle once it is stored, such as in
+/// \code{.cpp}
+/// auto slice = linear::Slice< 2, 2 >( linear::Multiply( a, b ), 0, 0 );
+/// \endcode
+/// thus the block is materialized into a \ref Matrix.
+///
+/// \pre The block must reside within the bounds of \p i_matrix.
+///
+/// \return the copied block.
+template < size_t SLICE_ROWS, size_t SLICE_COLUMNS, size_t ROWS, size_t COLS, typename ValueT >
+inline Matrix< SLICE_ROWS, SLICE_COLUMNS, ValueT >
+Slice( const Matrix< ROWS, COLS, ValueT >&& i_matrix, size_t i_rowOffset, size_t i_columnOffset )
+{
+    static_assert( SLICE_ROWS <= ROWS );
+    static_assert( SLICE_COLUMNS <= COLS );
+    LINEAR_ASSERT( i_rowOffset + SLICE_ROWS <= ROWS );
+    LINEAR_ASSERT( i_columnOffset + SLICE_COLUMNS <= COLS );
+    return Matrix< SLICE_ROWS, SLICE_COLUMNS, ValueT >(
+        SliceView< SLICE_ROWS, SLICE_COLUMNS, const ValueT >( &i_matrix( i_rowOffset, i_columnOffset ), COLS ) );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Get a \ref SliceView referencing a block of another slice view, sharing the storage of its parent.
+template < size_t SLICE_ROWS, size_t SLICE_COLUMNS, size_t ROWS, size_t COLS, typename ValueT >
+inline SliceView< SLICE_ROWS, SLICE_COLUMNS, ValueT >
+Slice( const SliceView< ROWS, COLS, ValueT >& i_view, size_t i_rowOffset, size_t i_columnOffset )
+{
+    static_assert( SLICE_ROWS <= ROWS );
+    static_assert( SLICE_COLUMNS <= COLS );
+    LINEAR_ASSERT( i_rowOffset + SLICE_ROWS <= ROWS );
+    LINEAR_ASSERT( i_columnOffset + SLICE_COLUMNS <= COLS );
+    return SliceView< SLICE_ROWS, SLICE_COLUMNS, ValueT >( &i_view( i_rowOffset, i_columnOffset ), i_view.RowStride() );
+}
+
 LINEAR_NS_CLOSE
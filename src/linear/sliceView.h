@@ -0,0 +1,301 @@
+#pragma once
+
+/// \file sliceView.h
+/// \ingroup LinearAlgebra_Types
+///
+/// A view referencing a rectangular block of entries of a matrix.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixColumn.h>
+#include <linear/base/matrixRow.h>
+
+#include <type_traits>
+
+LINEAR_NS_OPEN
+
+/// \class SliceView
+/// \ingroup LinearAlgebra_Types
+///
+/// Class referencing a ROWS x COLS block of entries in the storage of a parent matrix.
+///
+/// The shape of the slice is known at compile time, while its offset into the parent is specified at runtime.
+/// Entries are addressed through a pointer to the first entry of the block, and the row stride of the parent
+/// storage.  Writes through a mutable slice view modify the parent matrix, so algorithms can operate in-place
+/// on sub-matrices:
+/// \code{.cpp}
+/// linear::Matrix< 4, 4 > matrix;
+/// linear::SliceView< 2, 2, float > block = linear::Slice< 2, 2 >( matrix, 2, 2 );
+/// block = linear::Matrix< 2, 2 >::Identity(); // Writes into the lower-right block of matrix.
+/// \endcode
+///
+/// Like \ref TransposeView, a slice view is materialized into a \ref Matrix upon construction or assignment of one.
+///
+/// \note The view references the storage of its parent, thus must not outlive it.
+///
+/// \tparam ROWS number of rows in the slice.
+/// \tparam COLS number of columns in the slice.
+/// \tparam ValueT value type of the entries.  A \p const qualified value type produces a read-only view.
+template < size_t ROWS, size_t COLS, typename ValueT = float >
+class SliceView final
+{
+public:
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename std::remove_const< ValueT >::type;
+
+    /// \var MatrixType
+    ///
+    /// The matrix type which this view materializes into.
+    using MatrixType = Matrix< ROWS, COLS, ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Construct a slice view from a pointer to the first entry of the block, and the row stride of the
+    /// storage it resides in.
+    ///
+    /// \param i_entries pointer to the first (upper-left) entry of the block.
+    /// \param i_rowStride number of entries between the start of consecutive rows.
+    constexpr explicit SliceView( ValueT* i_entries, size_t i_rowStride )
+        : m_entries( i_entries )
+        , m_rowStride( i_rowStride )
+    {
+    }
+
+    /// Copy constructor.  The constructed view references the same entries as \p i_view.
+    SliceView( const SliceView& i_view ) = default;
+
+    //-------------------------------------------------------------------------
+    /// \name Shape
+    //-------------------------------------------------------------------------
+
+    /// Get the row size of this slice.
+    ///
+    /// \return The row size.
+    constexpr static inline int RowCount()
+    {
+        return ROWS;
+    }
+
+    /// Get the column size of this slice.
+    ///
+    /// \return The column size.
+    constexpr static inline int ColumnCount()
+    {
+        return COLS;
+    }
+
+    /// Get the total number of entries in this slice.
+    ///
+    /// \return The total number of entries.
+    constexpr static inline int EntryCount()
+    {
+        return ROWS * COLS;
+    }
+
+    /// Get the number of entries between the start of consecutive rows in the parent storage.
+    ///
+    /// \return The row stride.
+    inline size_t RowStride() const
+    {
+        return m_rowStride;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Entry access
+    //-------------------------------------------------------------------------
+
+    /// Slice entry access by row & column indices.
+    ///
+    /// \param i_rowIndex row of the entry to access.
+    /// \param i_colIndex column of the entry to access.
+    ///
+    /// \return Value entry at row \p i_rowIndex and column \p i_colIndex of the slice.
+    inline ValueT& operator()( size_t i_rowIndex, size_t i_colIndex ) const
+    {
+        LINEAR_ASSERT_MSG( i_rowIndex < ROWS && i_colIndex < COLS,
+                           "Requested (%lu, %lu) exceeded bounds (%lu, %lu)\n",
+                           i_rowIndex,
+                           i_colIndex,
+                           ROWS,
+                           COLS );
+        return m_entries[ i_rowIndex * m_rowStride + i_colIndex ];
+    }
+
+    /// Slice entry access by single index, with respect to row-major.
+    ///
+    /// \param i_index the index of the entry to access.
+    ///
+    /// \return Value entry at entry \p i_index of the slice.
+    inline ValueT& operator[]( size_t i_index ) const
+    {
+        LINEAR_ASSERT_MSG( i_index < ROWS * COLS, "Requested index %lu exceeds size %lu\n", i_index, ROWS * COLS );
+        return m_entries[ ( i_index / COLS ) * m_rowStride + ( i_index % COLS ) ];
+    }
+
+    /// Extract a single row of the slice.
+    ///
+    /// \param i_rowIndex the index of the row to extract.
+    ///
+    /// \return the row of the slice.
+    inline Matrix< 1, COLS, ValueType > GetRow( size_t i_rowIndex ) const
+    {
+        LINEAR_ASSERT( i_rowIndex < ROWS );
+        return _MatrixRow< SliceView, Matrix< 1, COLS, ValueType > >( *this, i_rowIndex );
+    }
+
+    /// Set a single row of the slice.
+    ///
+    /// \param i_rowIndex the index of the row to set.
+    /// \param i_row the row values.
+    inline void SetRow( size_t i_rowIndex, const Matrix< 1, COLS, ValueType >& i_row ) const
+    {
+        LINEAR_ASSERT( i_rowIndex < ROWS );
+        for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+        {
+            ( *this )( i_rowIndex, columnIndex ) = i_row[ columnIndex ];
+        }
+    }
+
+    /// Extract a single column of the slice.
+    ///
+    /// \param i_colIndex the index of the column to extract.
+    ///
+    /// \return the column of the slice.
+    inline Matrix< ROWS, 1, ValueType > GetColumn( size_t i_colIndex ) const
+    {
+        LINEAR_ASSERT( i_colIndex < COLS );
+        return _MatrixColumn< SliceView, Matrix< ROWS, 1, ValueType > >( *this, i_colIndex );
+    }
+
+    /// Set a single column of the slice.
+    ///
+    /// \param i_colIndex the index of the column to set.
+    /// \param i_column the column values.
+    inline void SetColumn( size_t i_colIndex, const Matrix< ROWS, 1, ValueType >& i_column ) const
+    {
+        LINEAR_ASSERT( i_colIndex < COLS );
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            ( *this )( rowIndex, i_colIndex ) = i_column[ rowIndex ];
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Assignment
+    //-------------------------------------------------------------------------
+
+    /// Copy the entries of \p i_view into the entries referenced by this slice.
+    const SliceView& operator=( const SliceView& i_view ) const
+    {
+        return ( *this = MatrixType( i_view ) );
+    }
+
+    /// Copy the entries of \p i_matrix into the entries referenced by this slice.
+    const SliceView& operator=( const MatrixType& i_matrix ) const
+    {
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+            {
+                ( *this )( rowIndex, columnIndex ) = i_matrix( rowIndex, columnIndex );
+            }
+        }
+        return *this;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Comparison operators
+    //-------------------------------------------------------------------------
+
+    /// Equality comparison operator.
+    ///
+    /// \return true if the entries referenced by this slice and \p i_matrix are \em equal.
+    inline bool operator==( const MatrixType& i_matrix ) const
+    {
+        return MatrixType( *this ) == i_matrix;
+    }
+
+    /// In-equality comparison operator.
+    ///
+    /// \return true if the entries referenced by this slice and \p i_matrix are <em>not equal</em>.
+    inline bool operator!=( const MatrixType& i_matrix ) const
+    {
+        return !( *this == i_matrix );
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Arithmetic operators
+    //-------------------------------------------------------------------------
+
+    /// Matrix addition assignment, into the referenced entries.
+    inline void operator+=( const MatrixType& i_matrix ) const
+    {
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            ValueT* row = &( *this )( rowIndex, 0 );
+            for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+            {
+                row[ columnIndex ] += i_matrix( rowIndex, columnIndex );
+            }
+        }
+    }
+
+    /// Matrix subtraction assignment, from the referenced entries.
+    inline void operator-=( const MatrixType& i_matrix ) const
+    {
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            ValueT* row = &( *this )( rowIndex, 0 );
+            for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+            {
+                row[ columnIndex ] -= i_matrix( rowIndex, columnIndex );
+            }
+        }
+    }
+
+    /// Matrix-Scalar multiplication assignment, of the referenced entries.
+    inline void operator*=( const ValueType& i_scalar ) const
+    {
+        for ( size_t rowIndex = 0; rowIndex < ROWS; ++rowIndex )
+        {
+            ValueT* row = &( *this )( rowIndex, 0 );
+            for ( size_t columnIndex = 0; columnIndex < COLS; ++columnIndex )
+            {
+                row[ columnIndex ] *= i_scalar;
+            }
+        }
+    }
+
+private:
+    /// Pointer to the first entry of the slice, in the parent storage.
+    ValueT* m_entries = nullptr;
+
+    /// Number of entries between the start of consecutive rows.
+    size_t m_rowStride = 0;
+};
+
+/// Operator overload for << to enable writing the string representation of the slice into an output
+/// stream \p o_outputStream.
+///
+/// \param o_outputStream the output stream to write into.
+/// \param i_view the slice view.
+///
+/// \return the output stream.
+template < size_t ROWS, size_t COLS, typename ValueT >
+inline std::ostream& operator<<( std::ostream& o_outputStream, const SliceView< ROWS, COLS, ValueT >& i_view )
+{
+    o_outputStream << typename SliceView< ROWS, COLS, ValueT >::MatrixType( i_view ).GetString();
+    return o_outputStream;
+}
+
+LINEAR_NS_CLOSE
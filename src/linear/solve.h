@@ -0,0 +1,259 @@
+#pragma once
+
+/// \file solve.h
+/// \ingroup LinearAlgebra_Operations
+///
+/// Linear system solve.
+///
+/// Solves the linear system
+/// \f[
+/// AX = B
+/// \f]
+/// for \f$X\f$, where \f$B\f$ is a single column vector, or a matrix whose columns are many right-hand sides.
+///
+/// The solution is computed through elimination on the augmented system \f$[A | B]\f$, followed by back
+/// substitution, which is both cheaper and more accurate than computing \f$A^{-1}\f$ and multiplying it with
+/// \f$B\f$.
+///
+/// \ref SolveRefined instead factors \f$A\f$ in a lower precision, and recovers the accuracy of the full precision
+/// through iterative refinement.
+
+#include <linear/base/matrixSolve.h>
+#include <linear/eliminationWorkspace.h>
+#include <linear/linear.h>
+#include <linear/luDecomposition.h>
+#include <linear/matrix.h>
+#include <linear/multiply.h>
+#include <linear/pivoting.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+LINEAR_NS_OPEN
+
+/// The maximum number of refinement iterations of \ref SolveRefined, before falling back to a full precision
+/// factorization.
+constexpr int _REFINEMENT_MAX_ITERATIONS = 30;
+
+/// Compute the largest absolute entry of \p i_matrix.
+template < typename MatrixT >
+inline typename MatrixT::ValueType _MaxAbsEntry( const MatrixT& i_matrix )
+{
+    typename MatrixT::ValueType maxEntry = 0;
+    for ( int index = 0; index < MatrixT::EntryCount(); ++index )
+    {
+        maxEntry = std::max( maxEntry, std::abs( i_matrix[ index ] ) );
+    }
+    return maxEntry;
+}
+
+/// Compute the infinity norm of \p i_matrix, its largest absolute row sum.
+template < typename MatrixT >
+inline typename MatrixT::ValueType _InfinityNorm( const MatrixT& i_matrix )
+{
+    typename MatrixT::ValueType norm = 0;
+    for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        typename MatrixT::ValueType rowSum = 0;
+        for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            rowSum += std::abs( i_matrix( rowIndex, columnIndex ) );
+        }
+        norm = std::max( norm, rowSum );
+    }
+    return norm;
+}
+
+/// Copy the entries of \p i_matrix into \p o_matrix, converting their value type.
+///
+/// The entries are read through their row and column, as \p i_matrix may be a view whose entries are not stored
+/// contiguously, or in its own row-major order.
+template < typename MatrixT, typename OutputMatrixT >
+inline void _ConvertMatrix( const MatrixT& i_matrix, OutputMatrixT& o_matrix )
+{
+    static_assert( MatrixT::RowCount() == OutputMatrixT::RowCount() );
+    static_assert( MatrixT::ColumnCount() == OutputMatrixT::ColumnCount() );
+    for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            o_matrix( rowIndex, columnIndex ) = i_matrix( rowIndex, columnIndex );
+        }
+    }
+}
+
+/// Factorize \p i_matrix with \p o_decomposition, first copying it into a heap allocated matrix of the decomposed
+/// type if it is of another value type, or a view.
+template < typename DecompositionT, typename MatrixT >
+inline void _FactorizeConverted( const MatrixT& i_matrix, DecompositionT& o_decomposition )
+{
+    using DecomposedMatrixT = typename DecompositionT::MatrixType;
+    if constexpr ( std::is_same< MatrixT, DecomposedMatrixT >::value )
+    {
+        o_decomposition.Factorize( i_matrix );
+    }
+    else
+    {
+        const std::unique_ptr< DecomposedMatrixT > matrix = std::make_unique< DecomposedMatrixT >();
+        _ConvertMatrix( i_matrix, *matrix );
+        o_decomposition.Factorize( *matrix );
+    }
+}
+
+/// Solve the linear system \f$AX = B\f$ via <b>Gaussian Elimination</b> and back substitution.
+/// \ingroup LinearAlgebra_Operations
+///
+/// \pre The matrix \p i_matrix must be square.
+///
+/// \param i_matrix the co-efficient matrix \f$A\f$.
+/// \param i_rhs the right-hand side(s) \f$B\f$.
+/// \param o_solution the solution(s) \f$X\f$.
+///
+/// \tparam PivotT the pivoting policy.
+///
+/// \return \p true if the system has a unique solution. \p false if \p i_matrix is singular.
+template < typename PivotT = ZeroPivot, typename MatrixT, typename RHST >
+inline bool Solve( const MatrixT& i_matrix, const RHST& i_rhs, typename RHST::MatrixType& o_solution )
+{
+    // Working copy of the co-efficient matrix.
+    typename MatrixT::MatrixType matrix = i_matrix;
+
+    // Record of elimination factors.
+    MatrixEliminationRecord< MatrixT::RowCount(), typename MatrixT::ValueType > eliminationFactors;
+
+    o_solution = i_rhs;
+    return _MatrixSolve< PivotT >( matrix, o_solution, eliminationFactors );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Solve the linear system \f$AX = B\f$, using the scratch memory of \p io_workspace instead of the stack.
+///
+/// \param i_matrix the co-efficient matrix \f$A\f$.
+/// \param i_rhs the right-hand side(s) \f$B\f$.
+/// \param o_solution the solution(s) \f$X\f$.
+/// \param io_workspace reusable scratch memory.
+///
+/// \tparam PivotT the pivoting policy.
+///
+/// \return \p true if the system has a unique solution. \p false if \p i_matrix is singular.
+template < typename PivotT = ZeroPivot, typename MatrixT, typename RHST >
+inline bool Solve( const MatrixT&                                        i_matrix,
+                   const RHST&                                           i_rhs,
+                   typename RHST::MatrixType&                            o_solution,
+                   EliminationWorkspace< typename MatrixT::MatrixType >& io_workspace )
+{
+    io_workspace.WorkingMatrix() = i_matrix;
+    o_solution                   = i_rhs;
+    return _MatrixSolve< PivotT >( io_workspace.WorkingMatrix(), o_solution, io_workspace.EliminationFactors() );
+}
+
+/// Solve the linear system \f$AX = B\f$ via <b>mixed precision iterative refinement</b>.
+/// \ingroup LinearAlgebra_Operations
+///
+/// \f$A\f$ is factored by \ref LUDecomposition in the lower precision \p LowValueT, which processes twice as many
+/// entries per vector instruction and halves the memory traffic of the \f$O(n^3)\f$ factorization.  The solution is
+/// then refined in the precision of \f$A\f$:
+/// \f[
+/// R = B - AX, \quad AD = R, \quad X = X + D
+/// \f]
+/// where the residual \f$R\f$ is computed in full precision, and each correction \f$D\f$ is solved in
+/// \f$O(n^2)\f$ with the low precision factors, until the residual is at the level of the rounding errors of the
+/// full precision.
+///
+/// Refinement only converges if \f$A\f$ is well conditioned relative to the low precision.  Should the corrections
+/// stop shrinking, or the low precision factorization fail, \f$A\f$ is instead factored in full precision.
+///
+/// The factors are allocated on the heap, as they are as large as \f$A\f$ itself.  The full precision fallback
+/// allocates and factors a second decomposition of \f$A\f$ on top of the low precision one, such that a stalled
+/// refinement costs more than a plain \ref Solve.
+///
+/// \pre The matrix \p i_matrix must be square.
+///
+/// \param i_matrix the co-efficient matrix \f$A\f$.
+/// \param i_rhs the right-hand side(s) \f$B\f$.
+/// \param o_solution the solution(s) \f$X\f$.
+/// \param o_iterationCount the number of refinement iterations, or \p -1 if the system was solved with a full
+/// precision factorization instead.
+///
+/// \return \p true if the system has a unique solution. \p false if \p i_matrix is singular.
+///
+/// \tparam PivotT the pivoting policy.  Defaults to partial pivoting, as refinement relies on the low precision
+/// factors being backward stable.
+/// \tparam LowValueT the value type of the low precision factorization.
+template < typename PivotT = PartialPivot, typename LowValueT = float, typename MatrixT, typename RHST >
+inline bool SolveRefined( const MatrixT&             i_matrix,
+                          const RHST&                i_rhs,
+                          typename RHST::MatrixType& o_solution,
+                          int&                       o_iterationCount )
+{
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+    static_assert( RHST::RowCount() == MatrixT::RowCount() );
+    using ValueT        = typename MatrixT::ValueType;
+    using LUT           = LUDecomposition< typename MatrixT::MatrixType, PivotT >;
+    using LowMatrixT    = Matrix< MatrixT::RowCount(), MatrixT::ColumnCount(), LowValueT >;
+    using LowLUT        = LUDecomposition< LowMatrixT, PivotT >;
+    using LowRHST       = Matrix< RHST::RowCount(), RHST::ColumnCount(), LowValueT >;
+    using SolutionT     = typename RHST::MatrixType;
+    constexpr int N     = MatrixT::RowCount();
+    const ValueT  scale = _InfinityNorm( i_matrix ) * std::numeric_limits< ValueT >::epsilon() * std::sqrt( N );
+
+    const std::unique_ptr< LowLUT > lowLU = std::make_unique< LowLUT >();
+    _FactorizeConverted( i_matrix, *lowLU );
+
+    LowRHST lowRhs;
+    LowRHST lowSolution;
+    _ConvertMatrix( i_rhs, lowRhs );
+    if ( lowLU->Solve( lowRhs, lowSolution ) )
+    {
+        _ConvertMatrix( lowSolution, o_solution );
+
+        ValueT previousCorrectionNorm = std::numeric_limits< ValueT >::infinity();
+        for ( o_iterationCount = 0; o_iterationCount < _REFINEMENT_MAX_ITERATIONS; ++o_iterationCount )
+        {
+            const SolutionT residual = i_rhs - Multiply( i_matrix, o_solution );
+            if ( _MaxAbsEntry( residual ) <= _MaxAbsEntry( o_solution ) * scale )
+            {
+                return true;
+            }
+
+            _ConvertMatrix( residual, lowRhs );
+            lowLU->Solve( lowRhs, lowSolution );
+
+            // Refinement contracts the error by a constant factor per iteration, unless A is too ill-conditioned.
+            SolutionT correction;
+            _ConvertMatrix( lowSolution, correction );
+            const ValueT correctionNorm = _MaxAbsEntry( correction );
+            if ( !( correctionNorm <= 0.5 * previousCorrectionNorm ) )
+            {
+                break;
+            }
+
+            o_solution += correction;
+            previousCorrectionNorm = correctionNorm;
+        }
+    }
+
+    o_iterationCount = -1;
+    const std::unique_ptr< LUT > lu = std::make_unique< LUT >();
+    _FactorizeConverted( i_matrix, *lu );
+    return lu->Solve( i_rhs, o_solution );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Solve the linear system \f$AX = B\f$ via mixed precision iterative refinement, without reporting the number of
+/// iterations.
+template < typename PivotT = PartialPivot, typename LowValueT = float, typename MatrixT, typename RHST >
+inline bool SolveRefined( const MatrixT& i_matrix, const RHST& i_rhs, typename RHST::MatrixType& o_solution )
+{
+    int iterationCount;
+    return SolveRefined< PivotT, LowValueT >( i_matrix, i_rhs, o_solution, iterationCount );
+}
+
+LINEAR_NS_CLOSE
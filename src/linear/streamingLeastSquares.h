@@ -0,0 +1,318 @@
+#pragma once
+
+/// \file streamingLeastSquares.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Least squares over a sliding window of streaming observations.
+///
+/// The least squares problem \f$\min ||Ax - b||\f$ is maintained through the triangular factor of the QR
+/// decomposition of the augmented matrix \f$[A \, b]\f$:
+/// \f[
+/// \begin{bmatrix} R & z \\ 0 & \rho \end{bmatrix}
+/// \f]
+/// where the solution satisfies \f$Rx = z\f$, and \f$\rho\f$ is the norm of the residual.  Observations are rotated
+/// into, and down-dated out of, the factor as they enter and leave the window, rather than re-factoring the whole
+/// window after each observation.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixElimination.h>
+#include <linear/base/matrixQRUpdate.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+LINEAR_NS_OPEN
+
+/// \class StreamingLeastSquares
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// A least squares problem whose observations (rows) are appended over time, keeping the most recent \p WINDOW
+/// of them, and whose unknowns (columns) may be appended too:
+/// \code{.cpp}
+/// linear::StreamingLeastSquares< 3, 64 > fit;
+/// for ( const Sample& sample : samples )
+/// {
+///     fit.AppendRow( linear::Matrix< 1, 3 >( 1.0f, sample.t, sample.t * sample.t ), sample.value );
+/// }
+/// linear::Matrix< 3, 1 > coefficients;
+/// fit.Solve( coefficients );
+/// \endcode
+///
+/// Each appended or removed row costs \f$O(n^2)\f$ for \f$n\f$ columns, regardless of the size of the window.
+///
+/// \tparam MAX_COLUMNS the maximum number of columns.
+/// \tparam WINDOW the maximum number of rows.
+/// \tparam ValueT the value type of the entries.
+template < size_t MAX_COLUMNS, size_t WINDOW, typename ValueT = float >
+class StreamingLeastSquares final
+{
+public:
+    static_assert( MAX_COLUMNS > 0 && WINDOW > 0 );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = ValueT;
+
+    /// \var RowType
+    ///
+    /// The type of a row of \f$A\f$.  The entries beyond \ref ColumnCount are un-used.
+    using RowType = Matrix< 1, MAX_COLUMNS, ValueT >;
+
+    /// \var ColumnType
+    ///
+    /// The type of a column of \f$A\f$, with an entry per row of the window.  The entries beyond \ref RowCount are
+    /// un-used.
+    using ColumnType = Matrix< WINDOW, 1, ValueT >;
+
+    /// \var SolutionType
+    ///
+    /// The type of the solution \f$x\f$.  The entries beyond \ref ColumnCount are zero.
+    using SolutionType = Matrix< MAX_COLUMNS, 1, ValueT >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Construct an empty least squares problem, of \p i_columnCount columns and no rows.
+    ///
+    /// \param i_columnCount the initial number of columns.
+    explicit StreamingLeastSquares( int i_columnCount = MAX_COLUMNS )
+        : m_columnCount( i_columnCount )
+    {
+        LINEAR_ASSERT( i_columnCount >= 0 && i_columnCount <= int( MAX_COLUMNS ) );
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Updates
+    //-------------------------------------------------------------------------
+
+    /// Append the observation \f$a^Tx = b\f$ as a new row.  If the window is full, its oldest row is removed first.
+    ///
+    /// \param i_row the row \f$a^T\f$.
+    /// \param i_rhs the observed value \f$b\f$.
+    void AppendRow( const RowType& i_row, const ValueT& i_rhs )
+    {
+        if ( m_rowCount == WINDOW )
+        {
+            RemoveRow();
+        }
+
+        const int rowIndex = _StorageRow( m_rowCount++ );
+        std::copy( &i_row[ 0 ], &i_row[ 0 ] + MAX_COLUMNS, &m_rows( rowIndex, 0 ) );
+        m_rhs[ rowIndex ] = i_rhs;
+
+        std::array< ValueT, MAX_COLUMNS + 1 > augmentedRow;
+        _AugmentedRow( rowIndex, augmentedRow.data() );
+        _QRAppendRow( m_columnCount + 1, m_factor, augmentedRow.data() );
+    }
+
+    /// Remove the oldest row.
+    ///
+    /// Should rounding errors prevent down-dating the factorization, the window is re-factored instead.
+    ///
+    /// \return \p false if there are no rows to remove.
+    bool RemoveRow()
+    {
+        if ( m_rowCount == 0 )
+        {
+            return false;
+        }
+
+        std::array< ValueT, MAX_COLUMNS + 1 > augmentedRow;
+        _AugmentedRow( m_firstRow, augmentedRow.data() );
+        m_firstRow = ( m_firstRow + 1 ) % WINDOW;
+        m_rowCount--;
+
+        if ( !_QRRemoveRow< MAX_COLUMNS >( m_columnCount, augmentedRow.data(), m_factor ) )
+        {
+            _Refactor();
+        }
+        return true;
+    }
+
+    /// Append a new column (unknown) to \f$A\f$.
+    ///
+    /// The new column of \f$R\f$ is computed from the semi-normal equations \f$R^Tr = A^Tc\f$, which costs
+    /// \f$O(mn + n^2)\f$ for the \f$m\f$ rows of the window.
+    ///
+    /// \param i_column the entries of the new column, for each row of the window from the oldest.
+    ///
+    /// \return \p false if there already are \p MAX_COLUMNS columns, or if the new column is numerically
+    /// dependent on the existing ones, in which case it is not appended.
+    bool AppendColumn( const ColumnType& i_column )
+    {
+        const int columnIndex = m_columnCount;
+        if ( columnIndex == int( MAX_COLUMNS ) )
+        {
+            return false;
+        }
+
+        // A^T * c, c^T * c and b^T * c.
+        std::array< ValueT, MAX_COLUMNS > product{};
+        ValueT                            columnSquareSum = 0;
+        ValueT                            rhsProduct      = 0;
+        for ( int index = 0; index < m_rowCount; ++index )
+        {
+            const int    rowIndex = _StorageRow( index );
+            const ValueT value    = i_column[ index ];
+            _EliminateRow( &m_rows( rowIndex, 0 ), -value, 0, columnIndex, product.data() );
+            columnSquareSum += value * value;
+            rhsProduct += m_rhs[ rowIndex ] * value;
+        }
+
+        // Solve R^T * r = A^T * c, in-place.
+        for ( int index = 0; index < columnIndex; ++index )
+        {
+            if ( m_factor( index, index ) == 0 )
+            {
+                return false;
+            }
+
+            for ( int previousIndex = 0; previousIndex < index; ++previousIndex )
+            {
+                product[ index ] -= m_factor( previousIndex, index ) * product[ previousIndex ];
+            }
+            product[ index ] /= m_factor( index, index );
+        }
+
+        const ValueT diagonalSquare = columnSquareSum - _DotProduct( product.data(), product.data(), columnIndex );
+        if ( !( diagonalSquare > columnSquareSum * std::numeric_limits< ValueT >::epsilon() ) )
+        {
+            return false;
+        }
+
+        // The right-hand side moves over to make space for the new column.
+        const ValueT diagonal       = std::sqrt( diagonalSquare );
+        const ValueT residualSquare = m_factor( columnIndex, columnIndex ) * m_factor( columnIndex, columnIndex );
+        ValueT       newRhs         = rhsProduct;
+        for ( int index = 0; index < columnIndex; ++index )
+        {
+            newRhs -= m_factor( index, columnIndex ) * product[ index ];
+            m_factor( index, columnIndex + 1 ) = m_factor( index, columnIndex );
+            m_factor( index, columnIndex )     = product[ index ];
+        }
+        newRhs /= diagonal;
+
+        m_factor( columnIndex, columnIndex )         = diagonal;
+        m_factor( columnIndex, columnIndex + 1 )     = newRhs;
+        m_factor( columnIndex + 1, columnIndex + 1 ) =
+            std::sqrt( std::max< ValueT >( 0, residualSquare - newRhs * newRhs ) );
+
+        for ( int index = 0; index < m_rowCount; ++index )
+        {
+            m_rows( _StorageRow( index ), columnIndex ) = i_column[ index ];
+        }
+        m_columnCount++;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Get the number of rows in the window.
+    ///
+    /// \return the number of rows.
+    inline int RowCount() const
+    {
+        return m_rowCount;
+    }
+
+    /// Get the number of columns.
+    ///
+    /// \return the number of columns.
+    inline int ColumnCount() const
+    {
+        return m_columnCount;
+    }
+
+    /// Get the norm of the residual \f$||Ax - b||\f$ of the least squares solution.
+    ///
+    /// \return the residual norm.
+    inline ValueT ResidualNorm() const
+    {
+        return std::abs( m_factor( m_columnCount, m_columnCount ) );
+    }
+
+    /// Solve the least squares problem over the rows of the window, in \f$O(n^2)\f$.
+    ///
+    /// \param o_solution the least squares solution \f$x\f$.
+    ///
+    /// \return \p true if the solution is unique.  \p false if the rows of the window do not determine every
+    /// unknown, in which case \p o_solution is un-defined.
+    bool Solve( SolutionType& o_solution ) const
+    {
+        if ( m_rowCount < m_columnCount )
+        {
+            return false;
+        }
+
+        o_solution = SolutionType();
+        for ( int index = m_columnCount - 1; index >= 0; --index )
+        {
+            if ( m_factor( index, index ) == 0 )
+            {
+                return false;
+            }
+
+            ValueT value = m_factor( index, m_columnCount );
+            for ( int nextIndex = index + 1; nextIndex < m_columnCount; ++nextIndex )
+            {
+                value -= m_factor( index, nextIndex ) * o_solution[ nextIndex ];
+            }
+            o_solution[ index ] = value / m_factor( index, index );
+        }
+
+        return true;
+    }
+
+private:
+    /// The index of row \p i_index of the window, counting from the oldest, within the storage of the rows.
+    inline int _StorageRow( int i_index ) const
+    {
+        return ( m_firstRow + i_index ) % WINDOW;
+    }
+
+    /// Gather the augmented row \f$[a^T \, b]\f$ stored at \p i_rowIndex.
+    inline void _AugmentedRow( int i_rowIndex, ValueT* o_row ) const
+    {
+        std::copy( &m_rows( i_rowIndex, 0 ), &m_rows( i_rowIndex, 0 ) + m_columnCount, o_row );
+        o_row[ m_columnCount ] = m_rhs[ i_rowIndex ];
+    }
+
+    /// Factor the rows of the window from scratch.
+    void _Refactor()
+    {
+        m_factor = FactorType();
+        for ( int index = 0; index < m_rowCount; ++index )
+        {
+            std::array< ValueT, MAX_COLUMNS + 1 > augmentedRow;
+            _AugmentedRow( _StorageRow( index ), augmentedRow.data() );
+            _QRAppendRow( m_columnCount + 1, m_factor, augmentedRow.data() );
+        }
+    }
+
+    /// The triangular factor of the augmented matrix.
+    using FactorType = Matrix< MAX_COLUMNS + 1, MAX_COLUMNS + 1, ValueT >;
+    FactorType m_factor;
+
+    /// The rows of the window, in a ring buffer starting at m_firstRow.
+    Matrix< WINDOW, MAX_COLUMNS, ValueT > m_rows;
+    Matrix< WINDOW, 1, ValueT >           m_rhs;
+    int                                   m_firstRow = 0;
+    int                                   m_rowCount = 0;
+
+    int m_columnCount = 0;
+};
+
+LINEAR_NS_CLOSE
@@ -0,0 +1,211 @@
+#pragma once
+
+/// \file symmetricEigenDecomposition.h
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Symmetric eigendecomposition.
+///
+/// A symmetric matrix \f$A\f$ is factored into
+/// \f[
+/// A = V \Lambda V^T
+/// \f]
+/// where \f$\Lambda\f$ is diagonal with the real eigenvalues of \f$A\f$, and the columns of the orthonormal matrix
+/// \f$V\f$ are the corresponding eigenvectors.  Typical uses are the principal axes of inertia tensors and
+/// covariance matrices.
+///
+/// The decomposition is computed by the cyclic Jacobi eigenvalue algorithm, which is simple, accurate, and
+/// well-suited to small fixed-size matrices.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/matrixJacobiEigen.h>
+
+#include <algorithm>
+#include <array>
+
+LINEAR_NS_OPEN
+
+/// \class SymmetricEigenDecomposition
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// The eigendecomposition of a symmetric matrix, with the eigenvalues sorted in ascending order.
+///
+/// Only the lower triangular part of the decomposed matrix is read.
+///
+/// \tparam MatrixT the type of the symmetric matrix to decompose.
+template < typename MatrixT >
+class SymmetricEigenDecomposition final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the decomposed matrix, and of its eigenvectors.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    /// \var EigenvaluesType
+    ///
+    /// The column vector type of the eigenvalues.
+    using EigenvaluesType = Matrix< MatrixType::RowCount(), 1, ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, which does not perform any factorization.
+    SymmetricEigenDecomposition() = default;
+
+    /// Construct the eigendecomposition of \p i_matrix.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    explicit SymmetricEigenDecomposition( const MatrixT& i_matrix )
+    {
+        Factorize( i_matrix );
+    }
+
+    /// Factorize \p i_matrix, replacing the current decomposition.
+    ///
+    /// \param i_matrix the symmetric matrix to decompose.
+    ///
+    /// \return \p true if the Jacobi iteration converged to machine precision.  The decomposition is usable either
+    /// way, but less accurate otherwise.
+    bool Factorize( const MatrixT& i_matrix )
+    {
+        MatrixType diagonalized;
+        for ( int rowIndex = 0; rowIndex < MatrixType::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex <= rowIndex; ++columnIndex )
+            {
+                diagonalized( rowIndex, columnIndex ) = diagonalized( columnIndex, rowIndex ) =
+                    i_matrix( rowIndex, columnIndex );
+            }
+        }
+
+        m_hasConverged = _MatrixSymmetricEigen( diagonalized, m_eigenvectors );
+        for ( int index = 0; index < MatrixType::RowCount(); ++index )
+        {
+            m_eigenvalues[ index ] = diagonalized( index, index );
+        }
+        _SortEigenpairs( m_eigenvalues, m_eigenvectors );
+
+        return m_hasConverged;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Operations
+    //-------------------------------------------------------------------------
+
+    /// Check if the Jacobi iteration converged to machine precision.
+    ///
+    /// \return \p true if the iteration converged.
+    inline bool HasConverged() const
+    {
+        return m_hasConverged;
+    }
+
+    /// Get the eigenvalues, in ascending order.
+    ///
+    /// \return the eigenvalues.
+    inline const EigenvaluesType& Eigenvalues() const
+    {
+        return m_eigenvalues;
+    }
+
+    /// Get the unit eigenvectors, as the columns of an orthonormal matrix, ordered alike the eigenvalues.
+    ///
+    /// \return the eigenvectors.
+    inline const MatrixType& Eigenvectors() const
+    {
+        return m_eigenvectors;
+    }
+
+private:
+    /// The eigenvalues, in ascending order.
+    EigenvaluesType m_eigenvalues;
+
+    /// The eigenvectors, in the columns.
+    MatrixType m_eigenvectors;
+
+    /// Whether the Jacobi iteration converged.
+    bool m_hasConverged = false;
+};
+
+/// \ingroup LinearAlgebra_Decompositions
+///
+/// Compute the eigendecompositions of a batch of \p i_count symmetric matrices, such as the inertia tensors of
+/// many bodies, with the eigenvalues sorted in ascending order.
+///
+/// The matrices are processed in groups, interleaved such that each Jacobi rotation is vectorized across the
+/// matrices of a group.  As in \ref SymmetricEigenDecomposition, only the lower triangular part of each matrix is
+/// read.
+///
+/// \param i_matrices The input symmetric matrices.
+/// \param i_count The number of matrices.
+/// \param o_eigenvalues The eigenvalues of each matrix.
+/// \param o_eigenvectors The eigenvectors of each matrix, in the columns.
+template < size_t SIZE, typename ValueT >
+inline void SymmetricEigen( const Matrix< SIZE, SIZE, ValueT >* i_matrices,
+                            size_t                              i_count,
+                            Matrix< SIZE, 1, ValueT >*          o_eigenvalues,
+                            Matrix< SIZE, SIZE, ValueT >*       o_eigenvectors )
+{
+    constexpr size_t LANES = 8;
+
+    std::array< ValueT, SIZE * SIZE * LANES > matrixLanes;
+    std::array< ValueT, SIZE * SIZE * LANES > eigenvectorLanes;
+    for ( size_t batchBegin = 0; batchBegin < i_count; batchBegin += LANES )
+    {
+        const size_t batchSize = std::min( LANES, i_count - batchBegin );
+
+        // Interleave the lower triangles of the matrices, mirrored into the upper triangles.  Unused lanes are
+        // filled with the identity to keep them well-defined.
+        for ( size_t rowIndex = 0; rowIndex < SIZE; ++rowIndex )
+        {
+            for ( size_t columnIndex = 0; columnIndex < SIZE; ++columnIndex )
+            {
+                const size_t lowerRow    = std::max( rowIndex, columnIndex );
+                const size_t lowerColumn = std::min( rowIndex, columnIndex );
+                ValueT*      entryLanes  = &matrixLanes[ ( rowIndex * SIZE + columnIndex ) * LANES ];
+                for ( size_t laneIndex = 0; laneIndex < LANES; ++laneIndex )
+                {
+                    entryLanes[ laneIndex ] = laneIndex < batchSize
+                                                  ? i_matrices[ batchBegin + laneIndex ]( lowerRow, lowerColumn )
+                                                  : ( rowIndex == columnIndex ? 1 : 0 );
+                }
+            }
+        }
+
+        _MatrixSymmetricEigenLanes< SIZE, LANES >( matrixLanes, eigenvectorLanes );
+
+        // De-interleave.
+        for ( size_t laneIndex = 0; laneIndex < batchSize; ++laneIndex )
+        {
+            Matrix< SIZE, 1, ValueT >&    eigenvalues  = o_eigenvalues[ batchBegin + laneIndex ];
+            Matrix< SIZE, SIZE, ValueT >& eigenvectors = o_eigenvectors[ batchBegin + laneIndex ];
+            for ( size_t entryIndex = 0; entryIndex < SIZE * SIZE; ++entryIndex )
+            {
+                eigenvectors[ entryIndex ] = eigenvectorLanes[ entryIndex * LANES + laneIndex ];
+            }
+
+            for ( size_t index = 0; index < SIZE; ++index )
+            {
+                eigenvalues[ index ] = matrixLanes[ index * ( SIZE + 1 ) * LANES + laneIndex ];
+            }
+
+            _SortEigenpairs( eigenvalues, eigenvectors );
+        }
+    }
+}
+
+LINEAR_NS_CLOSE
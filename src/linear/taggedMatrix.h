@@ -0,0 +1,342 @@
+#pragma once
+
+/// \file taggedMatrix.h
+/// \ingroup LinearAlgebra_Types
+///
+/// Matrices tagged with a structural property.
+///
+/// Some matrices are known to possess a structure which allows operations to take a cheaper path, such as
+/// rotations (orthonormal matrices) whose inverse is their transpose.  Wrapping such a matrix in a \ref TaggedMatrix
+/// carries the property in its type:
+/// \code{.cpp}
+/// linear::OrthonormalMatrix< linear::Matrix< 3, 3 > > rotation( matrix );
+/// linear::Matrix< 3, 3 > inverse;
+/// linear::Inverse( rotation, inverse ); // Transpose, instead of elimination.
+/// \endcode
+///
+/// A property is a type providing static \p Check and \p Inverse functions.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/almost.h>
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixColumn.h>
+#include <linear/base/matrixOrthonormal.h>
+#include <linear/base/matrixRow.h>
+
+#include <type_traits>
+
+LINEAR_NS_OPEN
+
+/// \struct Orthonormal
+/// \ingroup LinearAlgebra_Types
+///
+/// Property of a square matrix whose columns are mutually orthogonal and of unit length, such as a rotation.
+/// Its inverse is its transpose.
+struct Orthonormal
+{
+    /// Check if \p i_matrix is orthonormal, within the tolerance of \ref AlmostEqual.
+    template < typename MatrixT >
+    static inline bool Check( const MatrixT& i_matrix )
+    {
+        static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+        return _MatrixIsOrthonormal< MatrixT::ColumnCount() >( i_matrix );
+    }
+
+    /// Compute the inverse of the orthonormal matrix \p i_matrix, as its transpose.
+    template < typename MatrixT >
+    static inline void Inverse( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+    {
+        typename MatrixT::MatrixType inverse;
+        for ( int rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+        {
+            for ( int columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+            {
+                inverse( rowIndex, columnIndex ) = i_matrix( columnIndex, rowIndex );
+            }
+        }
+        o_inverse = inverse;
+    }
+};
+
+/// \struct Rigid
+/// \ingroup LinearAlgebra_Types
+///
+/// Property of a homogeneous rigid transformation matrix, composed of a rotation \f$R\f$ and a translation
+/// \f$t\f$ applied to column vectors:
+/// \f[
+/// M = \begin{bmatrix} R & t \\ 0 & 1 \end{bmatrix}
+/// \f]
+/// Its inverse is
+/// \f[
+/// M^{-1} = \begin{bmatrix} R^T & -R^Tt \\ 0 & 1 \end{bmatrix}
+/// \f]
+struct Rigid
+{
+    /// Check if \p i_matrix is a rigid transformation, within the tolerance of \ref AlmostEqual.
+    template < typename MatrixT >
+    static inline bool Check( const MatrixT& i_matrix )
+    {
+        static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+        using ValueT               = typename MatrixT::ValueType;
+        constexpr size_t lastIndex = MatrixT::RowCount() - 1;
+        for ( size_t columnIndex = 0; columnIndex < lastIndex; ++columnIndex )
+        {
+            if ( !AlmostEqual< ValueT >( i_matrix( lastIndex, columnIndex ), 0 ) )
+            {
+                return false;
+            }
+        }
+
+        return AlmostEqual< ValueT >( i_matrix( lastIndex, lastIndex ), 1 ) &&
+               _MatrixIsOrthonormal< lastIndex >( i_matrix );
+    }
+
+    /// Compute the inverse of the rigid transformation \p i_matrix, by transposing its rotation and rotating the
+    /// negated translation.
+    template < typename MatrixT >
+    static inline void Inverse( const MatrixT& i_matrix, typename MatrixT::MatrixType& o_inverse )
+    {
+        constexpr int lastIndex = MatrixT::RowCount() - 1;
+
+        typename MatrixT::MatrixType inverse;
+        for ( int rowIndex = 0; rowIndex < lastIndex; ++rowIndex )
+        {
+            typename MatrixT::ValueType translation = 0;
+            for ( int columnIndex = 0; columnIndex < lastIndex; ++columnIndex )
+            {
+                inverse( rowIndex, columnIndex ) = i_matrix( columnIndex, rowIndex );
+                translation -= i_matrix( columnIndex, rowIndex ) * i_matrix( columnIndex, lastIndex );
+            }
+            inverse( rowIndex, lastIndex ) = translation;
+        }
+        inverse( lastIndex, lastIndex ) = 1;
+        o_inverse                       = inverse;
+    }
+};
+
+/// \class TaggedMatrix
+/// \ingroup LinearAlgebra_Types
+///
+/// A matrix carrying a structural property in its type, allowing operations such as \ref Inverse to select a
+/// cheaper path.
+///
+/// The property is trusted upon construction.  Use \ref MakeTaggedMatrix to check it first.  Debug builds verify
+/// the property where it is relied upon.
+///
+/// The tagged matrix is read-only, so that its property cannot be invalidated, and can be passed into any
+/// operation which accepts a matrix.
+///
+/// \tparam MatrixT the type of the matrix being tagged.
+/// \tparam PropertyT the structural property, such as \ref Orthonormal or \ref Rigid.
+template < typename MatrixT, typename PropertyT >
+class TaggedMatrix final
+{
+public:
+    static_assert( MatrixT::RowCount() == MatrixT::ColumnCount() );
+
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The type of the tagged matrix.
+    using MatrixType = typename MatrixT::MatrixType;
+
+    /// \var PropertyType
+    ///
+    /// The structural property of the tagged matrix.
+    using PropertyType = PropertyT;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Default constructor, tagging the identity matrix.
+    constexpr TaggedMatrix()
+        : m_matrix( MatrixType::Identity() )
+    {
+    }
+
+    /// Tag \p i_matrix, which is trusted to possess the property.
+    constexpr explicit TaggedMatrix( const MatrixType& i_matrix )
+        : m_matrix( i_matrix )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Shape
+    //-------------------------------------------------------------------------
+
+    /// Get the row size of the matrix.
+    ///
+    /// \return The row size.
+    constexpr static inline int RowCount()
+    {
+        return MatrixType::RowCount();
+    }
+
+    /// Get the column size of the matrix.
+    ///
+    /// \return The column size.
+    constexpr static inline int ColumnCount()
+    {
+        return MatrixType::ColumnCount();
+    }
+
+    /// Get the total number of entries in the matrix.
+    ///
+    /// \return The total number of entries.
+    constexpr static inline int EntryCount()
+    {
+        return MatrixType::EntryCount();
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Entry access
+    //-------------------------------------------------------------------------
+
+    /// Matrix entry read-access by row & column indices.
+    ///
+    /// \param i_rowIndex row of the entry to access.
+    /// \param i_colIndex column of the entry to access.
+    ///
+    /// \return Value entry at row \p i_rowIndex and column \p i_colIndex.
+    constexpr inline const ValueType& operator()( size_t i_rowIndex, size_t i_colIndex ) const
+    {
+        return m_matrix( i_rowIndex, i_colIndex );
+    }
+
+    /// Matrix entry read-access by single index, with respect to row-major.
+    ///
+    /// \param i_index the index of the entry to access.
+    ///
+    /// \return Value entry at entry \p i_index.
+    constexpr inline const ValueType& operator[]( size_t i_index ) const
+    {
+        return m_matrix[ i_index ];
+    }
+
+    /// Extract a single row of the matrix.
+    ///
+    /// \param i_rowIndex the index of the row to extract.
+    ///
+    /// \return the row of the matrix.
+    constexpr inline Matrix< 1, ColumnCount(), ValueType > GetRow( size_t i_rowIndex ) const
+    {
+        return m_matrix.GetRow( i_rowIndex );
+    }
+
+    /// Extract a single column of the matrix.
+    ///
+    /// \param i_colIndex the index of the column to extract.
+    ///
+    /// \return the column of the matrix.
+    constexpr inline Matrix< RowCount(), 1, ValueType > GetColumn( size_t i_colIndex ) const
+    {
+        return m_matrix.GetColumn( i_colIndex );
+    }
+
+    /// Get the tagged matrix.
+    ///
+    /// \return the tagged matrix.
+    constexpr inline const MatrixType& GetMatrix() const
+    {
+        return m_matrix;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Comparison operators
+    //-------------------------------------------------------------------------
+
+    /// Equality comparison operator.
+    ///
+    /// \return true if the tagged matrix and \p i_matrix are \em equal.
+    constexpr inline bool operator==( const MatrixType& i_matrix ) const
+    {
+        return m_matrix == i_matrix;
+    }
+
+    /// In-equality comparison operator.
+    ///
+    /// \return true if the tagged matrix and \p i_matrix are <em>not equal</em>.
+    constexpr inline bool operator!=( const MatrixType& i_matrix ) const
+    {
+        return !( *this == i_matrix );
+    }
+
+private:
+    /// The tagged matrix.
+    MatrixType m_matrix;
+};
+
+/// \var OrthonormalMatrix
+/// \ingroup LinearAlgebra_Types
+///
+/// A matrix tagged as orthonormal.
+template < typename MatrixT >
+using OrthonormalMatrix = TaggedMatrix< MatrixT, Orthonormal >;
+
+/// \var RigidMatrix
+/// \ingroup LinearAlgebra_Types
+///
+/// A homogeneous matrix tagged as a rigid transformation.
+template < typename MatrixT >
+using RigidMatrix = TaggedMatrix< MatrixT, Rigid >;
+
+/// Tag \p i_matrix with property \p PropertyT, if it is verified to possess it.
+/// \ingroup LinearAlgebra_Types
+///
+/// \param i_matrix the matrix to tag.
+/// \param o_taggedMatrix the output tagged matrix.
+///
+/// \tparam PropertyT the structural property.
+///
+/// \return \p true if \p i_matrix possesses the property.  \p false otherwise, in which case \p o_taggedMatrix is
+/// un-modified.
+template < typename PropertyT, typename MatrixT >
+inline bool MakeTaggedMatrix( const MatrixT&                                           i_matrix,
+                              TaggedMatrix< typename MatrixT::MatrixType, PropertyT >& o_taggedMatrix )
+{
+    if ( !PropertyT::Check( i_matrix ) )
+    {
+        return false;
+    }
+
+    o_taggedMatrix = TaggedMatrix< typename MatrixT::MatrixType, PropertyT >( i_matrix );
+    return true;
+}
+
+/// Operator overload for << to enable writing the string representation of the tagged matrix into an output
+/// stream \p o_outputStream.
+///
+/// \param o_outputStream the output stream to write into.
+/// \param i_matrix the tagged matrix.
+///
+/// \return the output stream.
+template < typename MatrixT, typename PropertyT >
+inline std::ostream& operator<<( std::ostream& o_outputStream, const TaggedMatrix< MatrixT, PropertyT >& i_matrix )
+{
+    o_outputStream << i_matrix.GetMatrix();
+    return o_outputStream;
+}
+
+/// Check if \p MatrixT is a \ref TaggedMatrix.
+template < typename MatrixT >
+struct _IsTaggedMatrix : std::false_type
+{
+};
+
+template < typename MatrixT, typename PropertyT >
+struct _IsTaggedMatrix< TaggedMatrix< MatrixT, PropertyT > > : std::true_type
+{
+};
+
+LINEAR_NS_CLOSE
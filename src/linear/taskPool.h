@@ -0,0 +1,323 @@
+#pragma once
+
+/// \file taskPool.h
+/// \ingroup LinearAlgebra_Types
+///
+/// Work-stealing thread pool, executing graphs of dependent tasks.
+///
+/// Large factorizations are expressed as a graph of tile-sized tasks, where each task runs once all the tasks it
+/// depends on have completed:
+/// \code{.cpp}
+/// #include <linear/parallelFactorization.h>
+///
+/// linear::TaskPool pool;
+/// auto lu = std::make_unique< linear::LUDecomposition< linear::Matrix< 2048, 2048, double > > >();
+/// linear::ParallelFactorize( *lu, *matrix, pool );
+/// \endcode
+
+#include <linear/linear.h>
+
+#include <linear/base/diagnostic.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+LINEAR_NS_OPEN
+
+/// \class TaskGraph
+/// \ingroup LinearAlgebra_Types
+///
+/// A directed acyclic graph of tasks, to be executed by a \ref TaskPool.
+///
+/// Tasks which modify the same data must be ordered by dependencies.  Then, the results do not depend on the
+/// scheduling of the tasks, nor on the number of threads.
+class TaskGraph final
+{
+public:
+    /// \var TaskIndex
+    ///
+    /// The index of a task within the graph.
+    using TaskIndex = size_t;
+
+    /// Add a task to the graph.
+    ///
+    /// \param i_function the work performed by the task.
+    ///
+    /// \return the index of the added task.
+    inline TaskIndex AddTask( std::function< void() > i_function )
+    {
+        m_tasks.push_back( Task{std::move( i_function ), {}, 0} );
+        return m_tasks.size() - 1;
+    }
+
+    /// Require task \p i_predecessor to complete before task \p i_successor starts.
+    ///
+    /// \param i_predecessor the task which must complete first.
+    /// \param i_successor the dependent task.
+    inline void AddDependency( TaskIndex i_predecessor, TaskIndex i_successor )
+    {
+        LINEAR_ASSERT( i_predecessor < m_tasks.size() && i_successor < m_tasks.size() );
+        m_tasks[ i_predecessor ].successors.push_back( i_successor );
+        m_tasks[ i_successor ].predecessorCount++;
+    }
+
+    /// Get the number of tasks in the graph.
+    ///
+    /// \return the number of tasks.
+    inline size_t TaskCount() const
+    {
+        return m_tasks.size();
+    }
+
+private:
+    friend class TaskPool;
+
+    /// A task, and its outgoing edges.
+    struct Task
+    {
+        std::function< void() > function;
+        std::vector< TaskIndex > successors;
+        size_t                   predecessorCount;
+    };
+
+    std::vector< Task > m_tasks;
+};
+
+/// \class TaskPool
+/// \ingroup LinearAlgebra_Types
+///
+/// A pool of worker threads executing a \ref TaskGraph.
+///
+/// Each thread owns a queue of ready tasks.  A completed task pushes the successors it releases onto the queue of
+/// its own thread, which pops the most recent task first, favouring tasks whose data is still in cache.  Idle
+/// threads steal the oldest tasks from the queues of other threads.
+///
+/// The thread calling \ref Run participates in the execution, so a pool of a single thread runs tasks serially
+/// without spawning any threads.  A pool runs a single graph at a time.
+class TaskPool final
+{
+public:
+    /// Construct a pool of \p i_threadCount threads, including the thread calling \ref Run.
+    ///
+    /// \param i_threadCount the number of threads.  Defaults to the number of hardware threads.
+    explicit TaskPool( size_t i_threadCount = std::thread::hardware_concurrency() )
+    {
+        i_threadCount = std::max< size_t >( i_threadCount, 1 );
+        for ( size_t threadIndex = 0; threadIndex < i_threadCount; ++threadIndex )
+        {
+            m_queues.push_back( std::make_unique< Queue >() );
+        }
+
+        for ( size_t threadIndex = 1; threadIndex < i_threadCount; ++threadIndex )
+        {
+            m_threads.emplace_back( [ this, threadIndex ]() { _WorkerLoop( threadIndex ); } );
+        }
+    }
+
+    TaskPool( const TaskPool& ) = delete;
+    TaskPool& operator=( const TaskPool& ) = delete;
+
+    /// Stop and join the worker threads.
+    ~TaskPool()
+    {
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+            m_isStopping = true;
+        }
+        m_condition.notify_all();
+
+        for ( std::thread& thread : m_threads )
+        {
+            thread.join();
+        }
+    }
+
+    /// Get the number of threads, including the thread calling \ref Run.
+    ///
+    /// \return the number of threads.
+    inline size_t ThreadCount() const
+    {
+        return m_queues.size();
+    }
+
+    /// Execute all the tasks of \p i_graph, respecting their dependencies, and wait for their completion.
+    ///
+    /// \param i_graph the graph of tasks to execute.
+    void Run( const TaskGraph& i_graph )
+    {
+        const size_t taskCount = i_graph.TaskCount();
+        if ( taskCount == 0 )
+        {
+            return;
+        }
+
+        m_graph                   = &i_graph;
+        m_pendingPredecessorCount = std::make_unique< std::atomic< size_t >[] >( taskCount );
+        m_remainingTaskCount      = taskCount;
+
+        // All the counts are initialized before any task is queued, as the workers may start releasing successors
+        // immediately.
+        for ( TaskGraph::TaskIndex taskIndex = 0; taskIndex < taskCount; ++taskIndex )
+        {
+            m_pendingPredecessorCount[ taskIndex ] = i_graph.m_tasks[ taskIndex ].predecessorCount;
+        }
+
+        // Distribute the tasks without dependencies across the queues.
+        size_t queueIndex = 0;
+        for ( TaskGraph::TaskIndex taskIndex = 0; taskIndex < taskCount; ++taskIndex )
+        {
+            if ( i_graph.m_tasks[ taskIndex ].predecessorCount == 0 )
+            {
+                _Push( queueIndex, taskIndex );
+                queueIndex = ( queueIndex + 1 ) % m_queues.size();
+            }
+        }
+
+        // Participate until every task has completed.
+        while ( m_remainingTaskCount > 0 )
+        {
+            TaskGraph::TaskIndex taskIndex;
+            if ( _Pop( 0, taskIndex ) )
+            {
+                _Execute( 0, taskIndex );
+            }
+            else
+            {
+                std::unique_lock< std::mutex > lock( m_mutex );
+                m_condition.wait( lock, [ this ]() { return m_remainingTaskCount == 0 || m_queuedTaskCount > 0; } );
+            }
+        }
+
+        m_graph = nullptr;
+    }
+
+private:
+    /// The ready tasks owned by a single thread.
+    struct Queue
+    {
+        std::mutex                         mutex;
+        std::deque< TaskGraph::TaskIndex > tasks;
+    };
+
+    /// Push the ready task \p i_taskIndex onto the queue of thread \p i_threadIndex, and wake an idle thread.
+    void _Push( size_t i_threadIndex, TaskGraph::TaskIndex i_taskIndex )
+    {
+        // Counted before being pushed, so that the count never falls below the number of queued tasks.
+        m_queuedTaskCount++;
+        {
+            std::lock_guard< std::mutex > lock( m_queues[ i_threadIndex ]->mutex );
+            m_queues[ i_threadIndex ]->tasks.push_back( i_taskIndex );
+        }
+
+        // Synchronize with threads about to wait, so that the notification is not lost.
+        {
+            std::lock_guard< std::mutex > lock( m_mutex );
+        }
+        m_condition.notify_one();
+    }
+
+    /// Pop the most recent task of the queue of thread \p i_threadIndex, or otherwise steal the oldest task of
+    /// another queue.
+    ///
+    /// \return \p true if a task was acquired.
+    bool _Pop( size_t i_threadIndex, TaskGraph::TaskIndex& o_taskIndex )
+    {
+        for ( size_t offset = 0; offset < m_queues.size(); ++offset )
+        {
+            Queue&                        queue = *m_queues[ ( i_threadIndex + offset ) % m_queues.size() ];
+            std::lock_guard< std::mutex > lock( queue.mutex );
+            if ( !queue.tasks.empty() )
+            {
+                if ( offset == 0 )
+                {
+                    o_taskIndex = queue.tasks.back();
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    o_taskIndex = queue.tasks.front();
+                    queue.tasks.pop_front();
+                }
+                m_queuedTaskCount--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Execute task \p i_taskIndex on thread \p i_threadIndex, then release its successors.
+    void _Execute( size_t i_threadIndex, TaskGraph::TaskIndex i_taskIndex )
+    {
+        const TaskGraph::Task& task = m_graph->m_tasks[ i_taskIndex ];
+        task.function();
+
+        for ( TaskGraph::TaskIndex successorIndex : task.successors )
+        {
+            if ( --m_pendingPredecessorCount[ successorIndex ] == 0 )
+            {
+                _Push( i_threadIndex, successorIndex );
+            }
+        }
+
+        if ( --m_remainingTaskCount == 0 )
+        {
+            {
+                std::lock_guard< std::mutex > lock( m_mutex );
+            }
+            m_condition.notify_all();
+        }
+    }
+
+    /// The loop of each worker thread, executing tasks until the pool is destroyed.
+    void _WorkerLoop( size_t i_threadIndex )
+    {
+        while ( true )
+        {
+            TaskGraph::TaskIndex taskIndex;
+            if ( _Pop( i_threadIndex, taskIndex ) )
+            {
+                _Execute( i_threadIndex, taskIndex );
+                continue;
+            }
+
+            std::unique_lock< std::mutex > lock( m_mutex );
+            m_condition.wait( lock, [ this ]() { return m_isStopping || m_queuedTaskCount > 0; } );
+            if ( m_isStopping )
+            {
+                return;
+            }
+        }
+    }
+
+    /// The queue of ready tasks of each thread.  The queue at index 0 belongs to the thread calling \ref Run.
+    std::vector< std::unique_ptr< Queue > > m_queues;
+
+    /// The worker threads.
+    std::vector< std::thread > m_threads;
+
+    /// Guards the sleeping and waking of threads.
+    std::mutex              m_mutex;
+    std::condition_variable m_condition;
+    bool                    m_isStopping = false;
+
+    /// The graph being run.
+    const TaskGraph* m_graph = nullptr;
+
+    /// The number of incomplete predecessors of each task of the graph being run.
+    std::unique_ptr< std::atomic< size_t >[] > m_pendingPredecessorCount;
+
+    /// The number of tasks of the graph being run which have yet to complete.
+    std::atomic< size_t > m_remainingTaskCount{0};
+
+    /// The number of tasks across all the queues.
+    std::atomic< size_t > m_queuedTaskCount{0};
+};
+
+LINEAR_NS_CLOSE
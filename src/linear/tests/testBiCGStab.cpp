@@ -0,0 +1,118 @@
+#include <catch2/catch.hpp>
+
+#include "testOperators.h"
+
+#include <linear/biCGStab.h>
+#include <linear/multiply.h>
+#include <linear/preconditioner.h>
+#include <linear/transpose.h>
+
+#include <cmath>
+
+TEST_CASE( "BiCGStab_Matrix" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    using VectorT = linear::Matrix< 4, 1, double >;
+    const MatrixT matrix(
+        4.0, -1.0, 0.0,  2.0,
+        1.0,  5.0, 2.0,  0.0,
+        0.0, -3.0, 6.0,  1.0,
+        0.5,  0.0, 1.0, -3.0
+    );
+    const VectorT rhs( 1.0, -2.0, 3.0, 0.5 );
+
+    linear::BiCGStab< VectorT > solver;
+    solver.SetTolerance( 1e-12 );
+    VectorT solution;
+    CHECK( solver.Solve( matrix, rhs, solution ) );
+    CHECK( linear::Multiply( matrix, solution ) == rhs );
+
+    // Warm started from the solution, there is nothing left to do.
+    CHECK( solver.Solve( matrix, rhs, solution ) );
+    CHECK( solver.IterationCount() == 0 );
+}
+
+TEST_CASE( "BiCGStab_Operator" )
+{
+    constexpr int N = 100;
+    using VectorT   = linear::Matrix< N, 1, double >;
+    const ConvectionDiffusion< N > operator_;
+
+    VectorT expected;
+    for ( int index = 0; index < N; ++index )
+    {
+        expected[ index ] = std::sin( 0.1 * index );
+    }
+    VectorT rhs;
+    operator_.Apply( expected, rhs );
+
+    linear::BiCGStab< VectorT > solver;
+    solver.SetTolerance( 1e-10 );
+    VectorT solution;
+    CHECK( solver.Solve( operator_, rhs, solution ) );
+    CHECK( solver.ResidualNorm() <= 1e-10 * std::sqrt( linear::Multiply( linear::Transpose( rhs ), rhs )[ 0 ] ) );
+    for ( int index = 0; index < N; ++index )
+    {
+        CHECK( solution[ index ] == Approx( expected[ index ] ).margin( 1e-6 ) );
+    }
+
+    // Too few iterations.
+    solver.SetMaxIterations( 2 );
+    solution = VectorT();
+    CHECK( !solver.Solve( operator_, rhs, solution ) );
+    CHECK( solver.IterationCount() == 2 );
+}
+
+TEST_CASE( "BiCGStab_Preconditioned" )
+{
+    constexpr int N = 20;
+    using MatrixT   = linear::Matrix< N, N, double >;
+    using VectorT   = linear::Matrix< N, 1, double >;
+    const ConvectionDiffusion< N > operator_;
+
+    // The matrix of the operator, which is tridiagonal, thus exactly factored by ILU(0).
+    MatrixT matrix;
+    VectorT column;
+    for ( int index = 0; index < N; ++index )
+    {
+        column[ index ] = 1.0;
+        VectorT product;
+        operator_.Apply( column, product );
+        for ( int rowIndex = 0; rowIndex < N; ++rowIndex )
+        {
+            matrix( rowIndex, index ) = product[ rowIndex ];
+        }
+        column[ index ] = 0.0;
+    }
+
+    VectorT rhs;
+    for ( int index = 0; index < N; ++index )
+    {
+        rhs[ index ] = std::cos( 0.3 * index );
+    }
+
+    linear::BiCGStab< VectorT > solver;
+    solver.SetTolerance( 1e-10 );
+    VectorT solution;
+    CHECK( solver.Solve( operator_, rhs, solution ) );
+    const int iterationCount = solver.IterationCount();
+
+    linear::IncompleteLUPreconditioner< MatrixT > incompleteLU;
+    REQUIRE( incompleteLU.Setup( matrix ) );
+    VectorT preconditionedSolution;
+    CHECK( solver.Solve( operator_, incompleteLU, rhs, preconditionedSolution ) );
+    CHECK( solver.IterationCount() == 1 );
+    CHECK( solver.IterationCount() < iterationCount );
+
+    linear::BlockJacobiPreconditioner< MatrixT, 4 > blockJacobi;
+    REQUIRE( blockJacobi.Setup( matrix ) );
+    VectorT blockJacobiSolution;
+    CHECK( solver.Solve( matrix, blockJacobi, rhs, blockJacobiSolution ) );
+    CHECK( solver.IterationCount() < iterationCount );
+
+    for ( int index = 0; index < N; ++index )
+    {
+        CHECK( preconditionedSolution[ index ] == Approx( solution[ index ] ).margin( 1e-8 ) );
+        CHECK( blockJacobiSolution[ index ] == Approx( solution[ index ] ).margin( 1e-8 ) );
+    }
+}
@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+
+#include <linear/choleskyDecomposition.h>
+#include <linear/multiply.h>
+#include <linear/parallelFactorization.h>
+#include <linear/transpose.h>
+
+#include <algorithm>
+#include <cmath>
+
+TEST_CASE( "CholeskyDecomposition" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    MatrixT matrix(
+        4.0, 12.0, -16.0,
+        12.0, 37.0, -43.0,
+        -16.0, -43.0, 98.0
+    );
+
+    linear::CholeskyDecomposition< MatrixT > cholesky( matrix );
+    CHECK( cholesky.IsPositiveDefinite() );
+    CHECK( cholesky.L() == MatrixT(
+        2.0, 0.0, 0.0,
+        6.0, 1.0, 0.0,
+        -8.0, 5.0, 3.0
+    ) );
+    CHECK( linear::Multiply( cholesky.L(), linear::Transpose( cholesky.L() ) ) == matrix );
+    CHECK( cholesky.Determinant() == Approx( 36.0 ) );
+    CHECK( cholesky.LogDeterminant() == Approx( std::log( 36.0 ) ) );
+
+    linear::Matrix< 3, 2, double > B(
+        1.0, 0.0,
+        2.0, -1.0,
+        3.0, 4.0
+    );
+    linear::Matrix< 3, 2, double > X;
+    CHECK( cholesky.Solve( B, X ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+
+    MatrixT inverse;
+    CHECK( cholesky.Inverse( inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+}
+
+TEST_CASE( "CholeskyDecomposition_NotPositiveDefinite" )
+{
+    using MatrixT = linear::Matrix< 2, 2, double >;
+    MatrixT indefinite(
+        1.0, 2.0,
+        2.0, 1.0
+    );
+
+    linear::CholeskyDecomposition< MatrixT > cholesky;
+    CHECK( !cholesky.Factorize( indefinite ) );
+    CHECK( !cholesky.IsPositiveDefinite() );
+
+    linear::Matrix< 2, 1, double > x;
+    CHECK( !cholesky.Solve( linear::Matrix< 2, 1, double >( 1.0, 1.0 ), x ) );
+}
+
+TEST_CASE( "LDLTDecomposition" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+
+    // Symmetric indefinite.
+    MatrixT matrix(
+        1.0, 2.0, 3.0,
+        2.0, 1.0, 4.0,
+        3.0, 4.0, 1.0
+    );
+
+    linear::LDLTDecomposition< MatrixT > ldlt( matrix );
+    CHECK( ldlt.IsNonSingular() );
+    CHECK( linear::Multiply( linear::Multiply( ldlt.L(), ldlt.D() ), linear::Transpose( ldlt.L() ) ) == matrix );
+    CHECK( ldlt.Determinant() == Approx( 20.0 ) );
+    CHECK( ldlt.LogDeterminant() == Approx( std::log( 20.0 ) ) );
+
+    linear::Matrix< 3, 1, double > b( 1.0, -2.0, 0.5 );
+    linear::Matrix< 3, 1, double > x;
+    CHECK( ldlt.Solve( b, x ) );
+    CHECK( linear::Multiply( matrix, x ) == b );
+
+    MatrixT inverse;
+    CHECK( ldlt.Inverse( inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+}
+
+TEST_CASE( "CholeskyDecomposition_Parallel" )
+{
+    using MatrixT = linear::Matrix< 18, 18, double >;
+    MatrixT matrix;
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            matrix( rowIndex, columnIndex ) = 1.0 / ( 1.0 + rowIndex + columnIndex );
+        }
+        matrix( rowIndex, rowIndex ) += 1.0;
+    }
+
+    linear::CholeskyDecomposition< MatrixT > serial( matrix );
+    REQUIRE( serial.IsPositiveDefinite() );
+    MatrixT serialL = serial.L();
+
+    for ( size_t threadCount : {1, 4} )
+    {
+        linear::TaskPool                         pool( threadCount );
+        linear::CholeskyDecomposition< MatrixT > parallel;
+        REQUIRE( linear::ParallelFactorize< 5 >( parallel, matrix, pool ) );
+        CHECK( linear::Multiply( parallel.L(), linear::Transpose( parallel.L() ) ) == matrix );
+        CHECK( parallel.L() == serialL );
+
+        // Independent of the number of threads.
+        linear::TaskPool                         serialPool( 1 );
+        linear::CholeskyDecomposition< MatrixT > reference;
+        linear::ParallelFactorize< 5 >( reference, matrix, serialPool );
+        MatrixT parallelL = parallel.L(), referenceL = reference.L();
+        CHECK( std::equal( &parallelL[ 0 ], &parallelL[ 0 ] + MatrixT::EntryCount(), &referenceL[ 0 ] ) );
+    }
+
+    linear::TaskPool                         pool( 2 );
+    linear::CholeskyDecomposition< MatrixT > indefinite;
+    matrix( 12, 12 ) = -1.0;
+    CHECK( !linear::ParallelFactorize< 5 >( indefinite, matrix, pool ) );
+}
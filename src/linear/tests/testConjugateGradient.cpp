@@ -0,0 +1,163 @@
+#include <catch2/catch.hpp>
+
+#include <linear/conjugateGradient.h>
+#include <linear/multiply.h>
+#include <linear/preconditioner.h>
+
+#include <cmath>
+
+namespace
+{
+// The 1D Laplacian with Dirichlet boundaries, applied without storing its matrix.
+template < int N >
+struct Laplacian
+{
+    void Apply( const linear::Matrix< N, 1, double >& i_x, linear::Matrix< N, 1, double >& o_y ) const
+    {
+        for ( int index = 0; index < N; ++index )
+        {
+            o_y[ index ] = 2.0 * i_x[ index ];
+            if ( index > 0 )
+            {
+                o_y[ index ] -= i_x[ index - 1 ];
+            }
+            if ( index + 1 < N )
+            {
+                o_y[ index ] -= i_x[ index + 1 ];
+            }
+        }
+    }
+};
+
+// The 2D Laplacian on a SIZE by SIZE grid, with the rows of the first half of the grid scaled up.
+template < int SIZE >
+linear::Matrix< SIZE * SIZE, SIZE * SIZE, double > ScaledLaplacian2D()
+{
+    linear::Matrix< SIZE * SIZE, SIZE * SIZE, double > matrix;
+    for ( int row = 0; row < SIZE; ++row )
+    {
+        for ( int column = 0; column < SIZE; ++column )
+        {
+            const int    index     = row * SIZE + column;
+            const double scale     = row < SIZE / 2 ? 100.0 : 1.0;
+            matrix( index, index ) = 4.0 * scale;
+            if ( column > 0 )
+            {
+                matrix( index, index - 1 ) = matrix( index - 1, index ) = -1.0;
+            }
+            if ( row > 0 )
+            {
+                matrix( index, index - SIZE ) = matrix( index - SIZE, index ) = -1.0;
+            }
+        }
+    }
+    return matrix;
+}
+} // namespace
+
+TEST_CASE( "ConjugateGradient_Matrix" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    using VectorT = linear::Matrix< 4, 1, double >;
+    const MatrixT matrix(
+        4.0, 1.0, 0.0, 0.5,
+        1.0, 5.0, 2.0, 0.0,
+        0.0, 2.0, 6.0, 1.0,
+        0.5, 0.0, 1.0, 3.0
+    );
+    const VectorT rhs( 1.0, -2.0, 3.0, 0.5 );
+
+    linear::ConjugateGradient< VectorT > solver;
+    solver.SetTolerance( 1e-12 );
+    VectorT solution;
+    CHECK( solver.Solve( matrix, rhs, solution ) );
+    CHECK( solver.IterationCount() <= 4 );
+    CHECK( linear::Multiply( matrix, solution ) == rhs );
+
+    // Warm started from the solution, there is nothing left to do.
+    CHECK( solver.Solve( matrix, rhs, solution ) );
+    CHECK( solver.IterationCount() == 0 );
+
+    // A zero right-hand side has the zero solution.
+    CHECK( solver.Solve( matrix, VectorT(), solution ) );
+    CHECK( solution == VectorT() );
+}
+
+TEST_CASE( "ConjugateGradient_Operator" )
+{
+    constexpr int N = 100;
+    using VectorT   = linear::Matrix< N, 1, double >;
+    const Laplacian< N > laplacian;
+
+    VectorT rhs;
+    for ( int index = 0; index < N; ++index )
+    {
+        rhs[ index ] = 1.0;
+    }
+
+    linear::ConjugateGradient< VectorT > solver;
+    solver.SetTolerance( 1e-10 );
+    VectorT solution;
+    CHECK( solver.Solve( laplacian, rhs, solution ) );
+    CHECK( solver.IterationCount() <= N );
+
+    // The exact solution is the parabola x_i = (i + 1) * (N - i) / 2.
+    for ( int index = 0; index < N; ++index )
+    {
+        CHECK( solution[ index ] == Approx( 0.5 * ( index + 1 ) * ( N - index ) ) );
+    }
+
+    // Too few iterations.
+    solver.SetMaxIterations( 5 );
+    solution = VectorT();
+    CHECK( !solver.Solve( laplacian, rhs, solution ) );
+    CHECK( solver.IterationCount() == 5 );
+}
+
+TEST_CASE( "ConjugateGradient_Indefinite" )
+{
+    using MatrixT = linear::Matrix< 2, 2, double >;
+    using VectorT = linear::Matrix< 2, 1, double >;
+
+    linear::ConjugateGradient< VectorT > solver;
+    VectorT                              solution;
+    CHECK( !solver.Solve( MatrixT( 1.0, 0.0, 0.0, -1.0 ), VectorT( 1.0, 1.0 ), solution ) );
+}
+
+TEST_CASE( "ConjugateGradient_Preconditioned" )
+{
+    constexpr int N = 25;
+    using MatrixT   = linear::Matrix< N, N, double >;
+    using VectorT   = linear::Matrix< N, 1, double >;
+    const MatrixT matrix = ScaledLaplacian2D< 5 >();
+
+    VectorT rhs;
+    for ( int index = 0; index < N; ++index )
+    {
+        rhs[ index ] = std::cos( 0.3 * index );
+    }
+
+    linear::ConjugateGradient< VectorT > solver;
+    solver.SetTolerance( 1e-10 );
+    VectorT solution;
+    CHECK( solver.Solve( matrix, rhs, solution ) );
+    const int iterationCount = solver.IterationCount();
+
+    linear::JacobiPreconditioner< MatrixT > jacobi;
+    REQUIRE( jacobi.Setup( matrix ) );
+    VectorT jacobiSolution;
+    CHECK( solver.Solve( matrix, jacobi, rhs, jacobiSolution ) );
+    CHECK( solver.IterationCount() < iterationCount );
+
+    linear::IncompleteCholeskyPreconditioner< MatrixT > incompleteCholesky;
+    REQUIRE( incompleteCholesky.Setup( matrix ) );
+    VectorT incompleteCholeskySolution;
+    CHECK( solver.Solve( matrix, incompleteCholesky, rhs, incompleteCholeskySolution ) );
+    CHECK( solver.IterationCount() < iterationCount );
+
+    for ( int index = 0; index < N; ++index )
+    {
+        CHECK( jacobiSolution[ index ] == Approx( solution[ index ] ).margin( 1e-8 ) );
+        CHECK( incompleteCholeskySolution[ index ] == Approx( solution[ index ] ).margin( 1e-8 ) );
+    }
+}
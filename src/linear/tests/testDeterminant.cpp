@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include <linear/determinant.h>
+#include <linear/luDecomposition.h>
 
 TEST_CASE( "Matrix_Determinant" )
 {
@@ -18,3 +19,171 @@ TEST_CASE( "Matrix_Determinant" )
         )
     ) == 3.0f );
 }
+
+TEST_CASE( "Matrix_Determinant_Workspace" )
+{
+    using MatrixT = linear::Matrix< 5, 5, double >;
+    linear::EliminationWorkspace< MatrixT > workspace;
+
+    MatrixT matrix(
+        2.0, 1.0, 1.0, 1.0, 1.0,
+        1.0, 2.0, 1.0, 1.0, 1.0,
+        1.0, 1.0, 2.0, 1.0, 1.0,
+        1.0, 1.0, 1.0, 2.0, 1.0,
+        1.0, 1.0, 1.0, 1.0, 2.0
+    );
+    CHECK( linear::Determinant( matrix ) == Approx( 6.0 ) );
+    CHECK( linear::Determinant( matrix, workspace ) == Approx( 6.0 ) );
+    CHECK( linear::Determinant( MatrixT::Identity(), workspace ) == Approx( 1.0 ) );
+}
+
+TEST_CASE( "Matrix_Determinant_Pivoting" )
+{
+    // Matrices larger than 4x4 are reduced through elimination, which is subject to the pivoting policy.
+    linear::Matrix< 5, 5, double > matrix(
+        0.0, 2.0, 1.0, 0.0, 0.0,
+        1.0, 1.0, 0.0, 0.0, 0.0,
+        3.0, 0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 0.0, 1.0
+    );
+    CHECK( linear::Determinant< linear::PartialPivot >( matrix ) == Approx( -5.0 ) );
+    CHECK( linear::Determinant< linear::ZeroPivot >( matrix ) == Approx( -5.0 ) );
+    CHECK( linear::Determinant< linear::NoPivot >( matrix ) == 0.0 );
+}
+
+TEST_CASE( "Matrix_Determinant_ClosedForm" )
+{
+    // Evaluated at compile-time.
+    static_assert( linear::Determinant( linear::Matrix< 1, 1 >( 3.0f ) ) == 3.0f );
+    static_assert( linear::Determinant( linear::Matrix< 2, 2 >(
+        1.0f, 2.0f,
+        3.0f, 4.0f
+    ) ) == -2.0f );
+    static_assert( linear::Determinant( linear::Matrix< 3, 3, int >(
+        0, 2, 1,
+        1, 1, 0,
+        3, 0, 1
+    ) ) == -5 );
+    static_assert( linear::Determinant( linear::Matrix< 4, 4, int >(
+        1, 0, 2, -1,
+        3, 0, 0, 5,
+        2, 1, 4, -3,
+        1, 0, 5, 0
+    ) ) == 30 );
+    static_assert( linear::IsSingular( linear::Matrix< 2, 2 >(
+        1.0f, 2.0f,
+        2.0f, 4.0f
+    ) ) );
+
+    // Agrees with elimination.
+    linear::Matrix< 4, 4, double > matrix(
+        1.0, 7.0, 0.25, 8.0,
+        0.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    );
+    linear::LUDecomposition< linear::Matrix< 4, 4, double > > lu( matrix );
+    CHECK( linear::Determinant( matrix ) == Approx( lu.Determinant() ) );
+    CHECK( !linear::IsSingular( matrix ) );
+}
+
+TEST_CASE( "Matrix_Determinant_Integral" )
+{
+    // Elimination would require fractions.
+    using MatrixT = linear::Matrix< 5, 5, int >;
+    const MatrixT matrix(
+        2, 1, 1, 1, 1,
+        1, 2, 1, 1, 1,
+        1, 1, 2, 1, 1,
+        1, 1, 1, 2, 1,
+        1, 1, 1, 1, 2
+    );
+    CHECK( linear::Determinant( matrix ) == 6 );
+
+    linear::EliminationWorkspace< MatrixT > workspace;
+    CHECK( linear::Determinant( matrix, workspace ) == 6 );
+
+    int determinant = 0;
+    CHECK( linear::TryDeterminant( matrix, determinant ) );
+    CHECK( determinant == 6 );
+
+    // Singular.
+    CHECK( linear::Determinant( MatrixT(
+        1, 2, 3, 4, 5,
+        2, 4, 6, 8, 10,
+        0, 1, 0, 1, 0,
+        1, 0, 1, 0, 1,
+        3, 3, 3, 3, 3
+    ) ) == 0 );
+}
+
+TEST_CASE( "Matrix_Determinant_Integral_Exact" )
+{
+    // The determinant is an odd integer beyond 2^53, which double precision cannot represent.
+    using MatrixT = linear::Matrix< 6, 6, long long >;
+    const MatrixT matrix(
+        0,    173,  459,  -142, -341, 61,
+        61,   -366, -479, -486, 318,  494,
+        243,  165,  -395, 39,   267,  456,
+        -358, -56,  392,  -301, 345,  394,
+        -284, -472, -243, -283, -201, 13,
+        -254, 282,  100,  -167, -235, 57
+    );
+
+    long long determinant = 0;
+    CHECK( linear::TryDeterminant( matrix, determinant ) );
+    CHECK( determinant == -16641118427484355LL );
+}
+
+TEST_CASE( "Matrix_Determinant_Integral_Overflow" )
+{
+    using MatrixT = linear::Matrix< 5, 5, int >;
+    MatrixT matrix;
+    for ( int index = 0; index < 5; ++index )
+    {
+        matrix( index, index ) = 1000;
+    }
+    matrix( 0, 4 ) = 1;
+
+    int determinant = 0;
+    CHECK( !linear::TryDeterminant( matrix, determinant ) );
+
+    // The same determinant fits 64 bits.
+    long long wideDeterminant = 0;
+    CHECK( linear::TryDeterminant( linear::Matrix< 5, 5, long long >(
+        1000, 0,    0,    0,    1,
+        0,    1000, 0,    0,    0,
+        0,    0,    1000, 0,    0,
+        0,    0,    0,    1000, 0,
+        0,    0,    0,    0,    1000
+    ), wideDeterminant ) );
+    CHECK( wideDeterminant == 1000000000000000LL );
+}
+
+TEST_CASE( "Matrix_IsSingular_Tolerance" )
+{
+    // The third row is the sum of the first two, which does not round to an exact zero determinant.
+    using MatrixT = linear::Matrix< 5, 5, double >;
+    const MatrixT singular(
+        0.1, 0.7, 0.3, 0.9, 0.2,
+        0.5, 0.2, -0.3, 0.4, 0.8,
+        0.6, 0.9, 0.0, 1.3, 1.0,
+        1.0, 0.0, 2.0, 1.0, 0.5,
+        0.3, 0.4, 0.1, 0.2, 0.6
+    );
+    CHECK( !linear::IsSingular( singular ) );
+    CHECK( linear::IsSingular( singular, 1e-12 ) );
+
+    // Requires a row exchange: exactly singular without pivoting, yet numerically non-singular.
+    const MatrixT exchanged(
+        0.0, 1.0, 0.0, 0.0, 0.0,
+        1.0, 0.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 0.0, 1.0
+    );
+    CHECK( linear::IsSingular< linear::NoPivot >( exchanged ) );
+    CHECK( !linear::IsSingular( exchanged ) );
+    CHECK( !linear::IsSingular( exchanged, 1e-12 ) );
+}
@@ -0,0 +1,85 @@
+#include <catch2/catch.hpp>
+
+#include <linear/inverse.h>
+#include <linear/inverseUpdate.h>
+#include <linear/multiply.h>
+
+TEST_CASE( "Matrix_InverseRankOneUpdate" )
+{
+    using MatrixT = linear::Matrix< 5, 5, double >;
+    using ColumnT = linear::Matrix< 5, 1, double >;
+    MatrixT matrix(
+        1.0, 7.0, 0.0,  8.0,   0.0,
+        5.0, 8.0, 9.0,  2.0,  -3.0,
+        9.0, 0.0, 1.0,  23.0, -2.0,
+        0.0, 1.0, 1.0,  0.0,  -9.0,
+        1.0, 8.0, 1.0,  2.0,   1.3
+    );
+    MatrixT inverse;
+    REQUIRE( linear::Inverse( matrix, inverse ) );
+
+    const ColumnT u( 1.0, -2.0, 0.5, 3.0, 1.0 );
+    const ColumnT v( 0.25, 1.0, -1.0, 2.0, 0.0 );
+    const MatrixT updated = matrix + linear::Multiply( u, linear::Transpose( v ) );
+
+    CHECK( linear::InverseRankOneUpdate( u, v, matrix, inverse ) );
+    CHECK( matrix == updated );
+    CHECK( linear::Multiply( updated, inverse ) == MatrixT::Identity() );
+}
+
+TEST_CASE( "Matrix_InverseRankOneUpdate_Fallback" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    using ColumnT = linear::Matrix< 3, 1, double >;
+    MatrixT matrix  = MatrixT::Identity();
+    MatrixT inverse = MatrixT::Identity();
+
+    // Removes the first diagonal entry: 1 + v^T * A^-1 * u = 0, so the updated matrix is singular.
+    CHECK( !linear::InverseRankOneUpdate( ColumnT( 1.0, 0.0, 0.0 ), ColumnT( -1.0, 0.0, 0.0 ), matrix, inverse ) );
+
+    // Nearly cancels the first diagonal entry, which is re-computed from the updated matrix.
+    matrix  = MatrixT::Identity();
+    inverse = MatrixT::Identity();
+    CHECK( linear::InverseRankOneUpdate(
+        ColumnT( 1.0, 1.0, 0.0 ), ColumnT( -1.0 + 1e-12, 0.0, 0.0 ), matrix, inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+}
+
+TEST_CASE( "Matrix_InverseLowRankUpdate" )
+{
+    using MatrixT = linear::Matrix< 5, 5, double >;
+    using UpdateT = linear::Matrix< 5, 2, double >;
+    MatrixT matrix(
+        1.0, 7.0, 0.0,  8.0,   0.0,
+        5.0, 8.0, 9.0,  2.0,  -3.0,
+        9.0, 0.0, 1.0,  23.0, -2.0,
+        0.0, 1.0, 1.0,  0.0,  -9.0,
+        1.0, 8.0, 1.0,  2.0,   1.3
+    );
+    MatrixT inverse;
+    REQUIRE( linear::Inverse( matrix, inverse ) );
+
+    const UpdateT u(
+        1.0, 0.0,
+        -2.0, 1.0,
+        0.5, 2.0,
+        3.0, -1.0,
+        1.0, 0.5
+    );
+    const UpdateT v(
+        0.25, 1.0,
+        1.0, 0.0,
+        -1.0, 3.0,
+        2.0, 1.0,
+        0.0, -2.0
+    );
+    const MatrixT updated = matrix + linear::Multiply( u, linear::Transpose( v ) );
+
+    CHECK( linear::InverseLowRankUpdate( u, v, matrix, inverse ) );
+    CHECK( matrix == updated );
+    CHECK( linear::Multiply( updated, inverse ) == MatrixT::Identity() );
+
+    // Reverting the update restores the original inverse.
+    CHECK( linear::InverseLowRankUpdate( -1.0 * u, v, matrix, inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+}
@@ -1,6 +1,8 @@
 #include <catch2/catch.hpp>
 
+#include <linear/determinant.h>
 #include <linear/inverse.h>
+#include <linear/luDecomposition.h>
 #include <linear/multiply.h>
 
 #include <iostream>
@@ -37,3 +39,286 @@ TEST_CASE( "Matrix_Inverse" )
         1.0f, 8.0f, 1.0f,  2.0f,   1.3f
     ) );
 }
+
+TEST_CASE( "Matrix_Inverse_Workspace" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    linear::EliminationWorkspace< MatrixT > workspace;
+
+    MatrixT matrix(
+        1.0, 7.0, 0.25, 8.0,
+        0.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    );
+    MatrixT inverse;
+    CHECK( linear::Inverse( matrix, inverse, workspace ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+
+    // Re-use of the same workspace.
+    MatrixT singular(
+        1.0, 2.0, 3.0, 4.0,
+        2.0, 4.0, 6.0, 8.0,
+        0.0, 1.0, 0.0, 1.0,
+        1.0, 0.0, 1.0, 0.0
+    );
+    CHECK( !linear::Inverse( singular, inverse, workspace ) );
+    CHECK( linear::Inverse( MatrixT::Identity(), inverse, workspace ) );
+    CHECK( inverse == MatrixT::Identity() );
+}
+
+TEST_CASE( "Matrix_Inverse_Pivoting" )
+{
+    // Diagonally dominant, does not require row exchanges.
+    linear::Matrix< 3, 3, double > diagonallyDominant(
+        4.0, 1.0, 1.0,
+        1.0, 5.0, 2.0,
+        0.0, 2.0, 6.0
+    );
+    linear::Matrix< 3, 3, double > inverse;
+    CHECK( linear::Inverse< linear::NoPivot >( diagonallyDominant, inverse ) );
+    CHECK( linear::Multiply( diagonallyDominant, inverse ) == linear::Matrix< 3, 3, double >::Identity() );
+
+    // A zero pivot cannot be resolved without row exchanges.
+    linear::Matrix< 2, 2, double > zeroPivot(
+        0.0, 1.0,
+        1.0, 1.0
+    );
+    linear::Matrix< 2, 2, double > zeroPivotInverse;
+    CHECK( !linear::Inverse< linear::NoPivot >( zeroPivot, zeroPivotInverse ) );
+    CHECK( linear::Inverse< linear::PartialPivot >( zeroPivot, zeroPivotInverse ) );
+    CHECK( linear::Multiply( zeroPivot, zeroPivotInverse ) == linear::Matrix< 2, 2, double >::Identity() );
+
+    // A tiny, non-zero pivot is exchanged for the largest co-efficient in its column.
+    linear::Matrix< 2, 2, double > tinyPivot(
+        1.0e-20, 1.0,
+        1.0, 1.0
+    );
+    linear::Matrix< 2, 2, double > tinyPivotInverse;
+    CHECK( linear::Inverse< linear::PartialPivot >( tinyPivot, tinyPivotInverse ) );
+    CHECK( linear::Multiply( tinyPivot, tinyPivotInverse ) == linear::Matrix< 2, 2, double >::Identity() );
+
+    // 4x4 matrices are also eliminated under an explicit pivoting policy, rather than inverted in closed-form.
+    linear::Matrix< 4, 4 > permutation(
+        0.0f, 0.0f, 1.0f, 0.0f,
+        2.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, -4.0f,
+        0.0f, 0.5f, 0.0f, 0.0f
+    );
+    linear::Matrix< 4, 4 > permutationInverse;
+    CHECK( !linear::Inverse< linear::NoPivot >( permutation, permutationInverse ) );
+    CHECK( linear::Inverse< linear::PartialPivot >( permutation, permutationInverse ) );
+    CHECK( linear::Multiply( permutation, permutationInverse ) == linear::Matrix< 4, 4 >::Identity() );
+}
+
+TEST_CASE( "Matrix_Inverse_Pivoting_5x5" )
+{
+    using MatrixT = linear::Matrix< 5, 5, double >;
+
+    // Diagonally dominant, does not require row exchanges.
+    MatrixT diagonallyDominant(
+        4.0, 1.0, 1.0, 0.0, 0.0,
+        1.0, 5.0, 2.0, 0.0, 1.0,
+        0.0, 2.0, 6.0, 1.0, 0.0,
+        1.0, 0.0, 1.0, 4.0, 1.0,
+        0.0, 1.0, 0.0, 1.0, 3.0
+    );
+    MatrixT inverse;
+    CHECK( linear::Inverse< linear::NoPivot >( diagonallyDominant, inverse ) );
+    CHECK( linear::Multiply( diagonallyDominant, inverse ) == MatrixT::Identity() );
+
+    // A zero pivot cannot be resolved without row exchanges.
+    MatrixT zeroPivot(
+        0.0, 1.0, 0.0, 0.0, 0.0,
+        1.0, 1.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 0.0, 1.0
+    );
+    CHECK( !linear::Inverse< linear::NoPivot >( zeroPivot, inverse ) );
+    CHECK( linear::Inverse< linear::PartialPivot >( zeroPivot, inverse ) );
+    CHECK( linear::Multiply( zeroPivot, inverse ) == MatrixT::Identity() );
+
+    // A tiny, non-zero pivot is exchanged for the largest co-efficient in its column.
+    MatrixT tinyPivot(
+        1.0e-20, 1.0, 0.0, 0.0, 0.0,
+        1.0, 1.0, 0.0, 0.0, 0.0,
+        0.0, 0.0, 1.0, 0.0, 0.0,
+        0.0, 0.0, 0.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 0.0, 1.0
+    );
+    CHECK( linear::Inverse< linear::PartialPivot >( tinyPivot, inverse ) );
+    CHECK( linear::Multiply( tinyPivot, inverse ) == MatrixT::Identity() );
+}
+
+template < typename MatrixT >
+void CHECK_CLOSED_FORM_INVERSE( const MatrixT& i_matrix )
+{
+    MatrixT expected;
+    CHECK( linear::LUDecomposition< MatrixT >( i_matrix ).Inverse( expected ) );
+
+    MatrixT inverse;
+    CHECK( linear::Inverse( i_matrix, inverse ) );
+    CHECK( inverse == expected );
+}
+
+TEST_CASE( "Matrix_Inverse_ClosedForm" )
+{
+    CHECK_CLOSED_FORM_INVERSE( linear::Matrix< 2, 2 >(
+        0.0f, 2.0f,
+        3.0f, 1.0f
+    ) );
+
+    CHECK_CLOSED_FORM_INVERSE( linear::Matrix< 3, 3, double >(
+        0.0, 2.0, 1.0,
+        1.0, 1.0, 0.0,
+        3.0, 0.0, 1.0
+    ) );
+
+    CHECK_CLOSED_FORM_INVERSE( linear::Matrix< 4, 4, double >(
+        1.0, 7.0, 0.25, 8.0,
+        0.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    ) );
+
+    // Single precision 4x4, which takes the SIMD path where available.
+    CHECK_CLOSED_FORM_INVERSE( linear::Matrix< 4, 4 >(
+        1.0f, 7.0f, 0.25f, 8.0f,
+        0.0f, 5.0f, 8.0f, 9.0f,
+        2.0f, -3.0f, 1.0f, 1.3f,
+        8.0f, 1.0f, 2.0f, 1.3f
+    ) );
+    CHECK_CLOSED_FORM_INVERSE( linear::Matrix< 4, 4 >(
+        0.0f, 0.0f, 1.0f, 0.0f,
+        2.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, -4.0f,
+        0.0f, 0.5f, 0.0f, 0.0f
+    ) );
+
+    // Singular matrices.
+    linear::Matrix< 2, 2 > singular2(
+        1.0f, 2.0f,
+        2.0f, 4.0f
+    );
+    linear::Matrix< 3, 3 > singular3(
+        1.0f, 2.0f, 3.0f,
+        4.0f, 5.0f, 6.0f,
+        5.0f, 7.0f, 9.0f
+    );
+    linear::Matrix< 4, 4 > singular4(
+        1.0f, 2.0f, 3.0f, 4.0f,
+        2.0f, 4.0f, 6.0f, 8.0f,
+        0.0f, 1.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 1.0f, 0.0f
+    );
+    CHECK( !linear::Inverse( singular2, singular2 ) );
+    CHECK( !linear::Inverse( singular3, singular3 ) );
+    CHECK( !linear::Inverse( singular4, singular4 ) );
+
+    // Singular matrices whose determinant does not round to exactly zero.
+    linear::Matrix< 2, 2 > roundedSingular2(
+        0.1f, 0.3f,
+        0.7f, 2.1f
+    );
+    linear::Matrix< 3, 3 > roundedSingular3(
+        0.1f, 0.1f, 0.1f,
+        0.5f, 0.2f, -0.3f,
+        0.6f, 0.3f, -0.2f
+    );
+    linear::Matrix< 4, 4 > roundedSingular4(
+        0.1f, 0.1f, 0.1f, 0.1f,
+        0.5f, 0.2f, -0.3f, 0.4f,
+        0.6f, 0.3f, -0.2f, 0.5f,
+        1.0f, 0.0f, 2.0f, 1.0f
+    );
+    linear::Matrix< 4, 4, double > roundedSingular4d(
+        0.1, 0.1, 0.1, 0.1,
+        0.5, 0.2, -0.3, 0.4,
+        0.6, 0.3, -0.2, 0.5,
+        1.0, 0.0, 2.0, 1.0
+    );
+    CHECK( !linear::Inverse( roundedSingular2, roundedSingular2 ) );
+    CHECK( !linear::Inverse( roundedSingular3, roundedSingular3 ) );
+    CHECK( !linear::Inverse( roundedSingular4, roundedSingular4 ) );
+    CHECK( !linear::Inverse( roundedSingular4d, roundedSingular4d ) );
+}
+
+TEST_CASE( "Matrix_Inverse_NearSingular_SizeBoundary" )
+{
+    // The rounded singular 4x4 is rejected in closed-form, but the same block within a 5x5 is only rejected by
+    // elimination upon an exactly zero pivot, which rounding prevents.
+    linear::Matrix< 4, 4, double > roundedSingular4(
+        0.1, 0.1, 0.1, 0.1,
+        0.5, 0.2, -0.3, 0.4,
+        0.6, 0.3, -0.2, 0.5,
+        1.0, 0.0, 2.0, 1.0
+    );
+    linear::Matrix< 5, 5, double > roundedSingular5(
+        0.1, 0.1, 0.1, 0.1, 0.0,
+        0.5, 0.2, -0.3, 0.4, 0.0,
+        0.6, 0.3, -0.2, 0.5, 0.0,
+        1.0, 0.0, 2.0, 1.0, 0.0,
+        0.0, 0.0, 0.0, 0.0, 1.0
+    );
+    linear::Matrix< 4, 4, double > inverse4;
+    linear::Matrix< 5, 5, double > inverse5;
+    CHECK( !linear::Inverse( roundedSingular4, inverse4 ) );
+    CHECK( linear::Inverse( roundedSingular5, inverse5 ) );
+
+    // The numerical singularity test does not depend on the size.
+    CHECK( linear::IsSingular( roundedSingular4, 1e-12 ) );
+    CHECK( linear::IsSingular( roundedSingular5, 1e-12 ) );
+}
+
+TEST_CASE( "Matrix_Inverse_LUDecomposition" )
+{
+    // Large enough to be inverted through the blocked LU decomposition.
+    using MatrixT = linear::Matrix< 20, 20, double >;
+    MatrixT matrix;
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            matrix( rowIndex, columnIndex ) = 1.0 / ( 1.0 + rowIndex + 2.0 * columnIndex );
+        }
+        matrix( rowIndex, rowIndex ) += 2.0;
+    }
+
+    MatrixT inverse;
+    REQUIRE( linear::Inverse< linear::PartialPivot >( matrix, inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+
+    MatrixT gaussJordanInverse;
+    REQUIRE( linear::_MatrixInverse< linear::PartialPivot >( matrix, gaussJordanInverse ) );
+    CHECK( inverse == gaussJordanInverse );
+
+    // Also within a workspace, rather than on the stack.
+    linear::EliminationWorkspace< MatrixT > workspace;
+    MatrixT                                 workspaceInverse;
+    REQUIRE( linear::Inverse< linear::PartialPivot >( matrix, workspaceInverse, workspace ) );
+    CHECK( workspaceInverse == inverse );
+
+    MatrixT singular = matrix;
+    singular.SetRow( 7, singular.GetRow( 3 ) );
+    CHECK( !linear::Inverse< linear::PartialPivot >( singular, inverse ) );
+    CHECK( !linear::Inverse< linear::PartialPivot >( singular, inverse, workspace ) );
+
+    // Rows shifted such that every pivot requires an exchange, which the inverse undoes as column exchanges.
+    MatrixT shifted;
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        shifted.SetRow( rowIndex, matrix.GetRow( ( rowIndex + 5 ) % MatrixT::RowCount() ) );
+        shifted( rowIndex, 2 * rowIndex % MatrixT::ColumnCount() ) -= 0.5;
+    }
+
+    linear::LUDecomposition< MatrixT, linear::PartialPivot > lu( shifted );
+    REQUIRE( lu.P() != MatrixT::Identity() );
+    MatrixT luInverse;
+    REQUIRE( lu.Inverse( luInverse ) );
+
+    REQUIRE( linear::Inverse< linear::PartialPivot >( shifted, inverse ) );
+    CHECK( inverse == luInverse );
+    CHECK( linear::Multiply( shifted, inverse ) == MatrixT::Identity() );
+    CHECK( linear::Multiply( inverse, shifted ) == MatrixT::Identity() );
+}
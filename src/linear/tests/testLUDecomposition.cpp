@@ -0,0 +1,194 @@
+#include <catch2/catch.hpp>
+
+#include <linear/luDecomposition.h>
+#include <linear/multiply.h>
+#include <linear/parallelFactorization.h>
+
+#include <algorithm>
+#include <cmath>
+
+TEST_CASE( "LUDecomposition_Factors" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    MatrixT matrix(
+        0.0, 7.0, 0.25, 8.0,
+        1.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    );
+
+    linear::LUDecomposition< MatrixT > lu( matrix );
+    CHECK( lu.IsNonSingular() );
+    CHECK( linear::Multiply( lu.P(), matrix ) == linear::Multiply( lu.L(), lu.U() ) );
+}
+
+TEST_CASE( "LUDecomposition_Solve" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    MatrixT matrix(
+        0.0, 2.0, 1.0,
+        1.0, 1.0, 0.0,
+        3.0, 0.0, 1.0
+    );
+    linear::LUDecomposition< MatrixT > lu( matrix );
+
+    // Single right-hand side.
+    linear::Matrix< 3, 1, double > b( 3.0, 2.0, 4.0 );
+    linear::Matrix< 3, 1, double > x;
+    CHECK( lu.Solve( b, x ) );
+    CHECK( linear::Multiply( matrix, x ) == b );
+
+    // Many right-hand sides.
+    linear::Matrix< 3, 2, double > B(
+        3.0, 1.0,
+        2.0, -1.0,
+        4.0, 0.5
+    );
+    linear::Matrix< 3, 2, double > X;
+    CHECK( lu.Solve( B, X ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+
+    // In-place solve.
+    X = B;
+    CHECK( lu.Solve( X, X ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+}
+
+TEST_CASE( "LUDecomposition_DeterminantAndInverse" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    MatrixT matrix(
+        0.0, 2.0, 1.0,
+        1.0, 1.0, 0.0,
+        3.0, 0.0, 1.0
+    );
+    linear::LUDecomposition< MatrixT > lu( matrix );
+    CHECK( lu.Determinant() == Approx( -5.0 ) );
+
+    MatrixT inverse;
+    CHECK( lu.Inverse( inverse ) );
+    CHECK( linear::Multiply( matrix, inverse ) == MatrixT::Identity() );
+}
+
+TEST_CASE( "LUDecomposition_Singular" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    MatrixT singular(
+        1.0, 2.0, 3.0,
+        2.0, 4.0, 6.0,
+        0.0, 1.0, 1.0
+    );
+
+    linear::LUDecomposition< MatrixT > lu;
+    CHECK( !lu.Factorize( singular ) );
+    CHECK( !lu.IsNonSingular() );
+    CHECK( lu.Determinant() == 0.0 );
+    CHECK( linear::Multiply( lu.P(), singular ) == linear::Multiply( lu.L(), lu.U() ) );
+
+    MatrixT inverse;
+    CHECK( !lu.Inverse( inverse ) );
+}
+
+TEST_CASE( "LUDecomposition_PartialPivot" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    MatrixT matrix(
+        1.0e-12, 7.0, 0.25, 8.0,
+        1.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    );
+
+    linear::LUDecomposition< MatrixT, linear::PartialPivot > lu( matrix );
+    CHECK( lu.IsNonSingular() );
+    CHECK( linear::Multiply( lu.P(), matrix ) == linear::Multiply( lu.L(), lu.U() ) );
+
+    // Elimination factors are bounded by 1 in magnitude.
+    MatrixT lower = lu.L();
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < rowIndex; ++columnIndex )
+        {
+            CHECK( std::abs( lower( rowIndex, columnIndex ) ) <= 1.0 );
+        }
+    }
+}
+
+TEST_CASE( "LUDecomposition_NoPivot" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    MatrixT matrix(
+        4.0, 1.0, 0.0, 0.0,
+        1.0, 4.0, 1.0, 0.0,
+        0.0, 1.0, 4.0, 1.0,
+        0.0, 0.0, 1.0, 4.0
+    );
+
+    linear::LUDecomposition< MatrixT, linear::NoPivot > lu( matrix );
+    REQUIRE( lu.IsNonSingular() );
+    CHECK( lu.P() == MatrixT::Identity() );
+    CHECK( linear::Multiply( lu.L(), lu.U() ) == matrix );
+
+    // Non-singular, but requires a row exchange.
+    MatrixT exchanged = matrix;
+    exchanged.SetRow( 0, matrix.GetRow( 1 ) );
+    exchanged.SetRow( 1, matrix.GetRow( 0 ) );
+    exchanged( 0, 0 ) = 0.0;
+    CHECK( !linear::LUDecomposition< MatrixT, linear::NoPivot >( exchanged ).IsNonSingular() );
+    CHECK( linear::LUDecomposition< MatrixT, linear::PartialPivot >( exchanged ).IsNonSingular() );
+}
+
+TEST_CASE( "LUDecomposition_Blocked" )
+{
+    // A block size of 2 factors the 7x7 matrix in 4 panels, with a partial trailing panel.
+    using MatrixT = linear::Matrix< 7, 7, double >;
+    MatrixT matrix;
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            matrix( rowIndex, columnIndex ) = double( ( rowIndex * 5 + columnIndex * 3 ) % 7 ) - 3.0 + rowIndex;
+        }
+    }
+
+    linear::LUDecomposition< MatrixT, linear::PartialPivot >    unblocked( matrix );
+    linear::LUDecomposition< MatrixT, linear::PartialPivot, 2 > blocked( matrix );
+    REQUIRE( blocked.IsNonSingular() );
+    CHECK( linear::Multiply( blocked.P(), matrix ) == linear::Multiply( blocked.L(), blocked.U() ) );
+    CHECK( blocked.P() == unblocked.P() );
+    CHECK( blocked.L() == unblocked.L() );
+    CHECK( blocked.U() == unblocked.U() );
+    CHECK( blocked.Determinant() == Approx( unblocked.Determinant() ) );
+}
+
+TEST_CASE( "LUDecomposition_Parallel" )
+{
+    using MatrixT = linear::Matrix< 19, 19, double >;
+    MatrixT matrix;
+    for ( size_t rowIndex = 0; rowIndex < MatrixT::RowCount(); ++rowIndex )
+    {
+        for ( size_t columnIndex = 0; columnIndex < MatrixT::ColumnCount(); ++columnIndex )
+        {
+            matrix( rowIndex, columnIndex ) = std::sin( 1.0 + rowIndex * 19 + columnIndex * 7 );
+        }
+    }
+
+    // The serial blocked factorization with the same block size as the tiles.
+    linear::LUDecomposition< MatrixT, linear::PartialPivot, 4 > serial( matrix );
+    REQUIRE( serial.IsNonSingular() );
+
+    for ( size_t threadCount : {1, 3} )
+    {
+        linear::TaskPool                                         pool( threadCount );
+        linear::LUDecomposition< MatrixT, linear::PartialPivot > parallel;
+        REQUIRE( linear::ParallelFactorize< 4 >( parallel, matrix, pool ) );
+        CHECK( linear::Multiply( parallel.P(), matrix ) == linear::Multiply( parallel.L(), parallel.U() ) );
+
+        // Bitwise identical factors.
+        MatrixT serialL = serial.L(), serialU = serial.U(), parallelL = parallel.L(), parallelU = parallel.U();
+        CHECK( std::equal( &serialL[ 0 ], &serialL[ 0 ] + MatrixT::EntryCount(), &parallelL[ 0 ] ) );
+        CHECK( std::equal( &serialU[ 0 ], &serialU[ 0 ] + MatrixT::EntryCount(), &parallelU[ 0 ] ) );
+        CHECK( parallel.P() == serial.P() );
+        CHECK( parallel.Determinant() == serial.Determinant() );
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+/// \file tests/testOperators.h
+///
+/// Operators shared by the tests of the iterative solvers.
+
+#include <linear/matrix.h>
+
+// A 1D convection-diffusion operator, which is not symmetric, applied without storing its matrix.
+template < int N >
+struct ConvectionDiffusion
+{
+    void Apply( const linear::Matrix< N, 1, double >& i_x, linear::Matrix< N, 1, double >& o_y ) const
+    {
+        for ( int index = 0; index < N; ++index )
+        {
+            o_y[ index ] = 2.0 * i_x[ index ];
+            if ( index > 0 )
+            {
+                o_y[ index ] -= 1.4 * i_x[ index - 1 ];
+            }
+            if ( index + 1 < N )
+            {
+                o_y[ index ] -= 0.6 * i_x[ index + 1 ];
+            }
+        }
+    }
+};
@@ -1,8 +1,11 @@
 #include <catch2/catch.hpp>
 
+#include <linear/multiply.h>
 #include <linear/orthonormalize.h>
+#include <linear/transpose.h>
 
 #include <iostream>
+#include <vector>
 
 TEST_CASE( "Matrix_Orthonormalize" )
 {
@@ -32,3 +35,45 @@ TEST_CASE( "Matrix_Orthonormalize" )
         )
     );
 }
+
+TEST_CASE( "Matrix_Orthonormalize_InPlace" )
+{
+    using MatrixT = linear::Matrix< 4, 3, double >;
+    MatrixT matrix(
+        1.0, 1.0, 1.0,
+        1.0e-8, 0.0, 0.0,
+        0.0, 1.0e-8, 0.0,
+        0.0, 0.0, 1.0e-8
+    );
+
+    // Nearly dependent columns, re-orthogonalized to keep the result orthogonal to working precision.
+    linear::Orthonormalize< 2 >( matrix, matrix );
+    CHECK( linear::Multiply( linear::Transpose( matrix ), matrix ) == linear::Matrix< 3, 3, double >::Identity() );
+}
+
+TEST_CASE( "Matrix_Orthonormalize_Batch" )
+{
+    using MatrixT = linear::Matrix< 3, 3 >;
+
+    // More matrices than a single group, to exercise the partially filled group.
+    std::vector< MatrixT > matrices;
+    for ( int matrixIndex = 0; matrixIndex < 11; ++matrixIndex )
+    {
+        matrices.push_back( MatrixT(
+            1.0f, 0.1f * matrixIndex, 0.0f,
+            0.01f, 1.0f, 0.2f,
+            0.0f, -0.1f, 1.0f + matrixIndex
+        ) );
+    }
+
+    std::vector< MatrixT > orthonormals( matrices.size() );
+    linear::Orthonormalize( matrices.data(), matrices.size(), orthonormals.data() );
+    for ( size_t matrixIndex = 0; matrixIndex < matrices.size(); ++matrixIndex )
+    {
+        CHECK( orthonormals[ matrixIndex ] == linear::Orthonormalize( matrices[ matrixIndex ] ) );
+    }
+
+    // In-place.
+    linear::Orthonormalize( matrices.data(), matrices.size(), matrices.data() );
+    CHECK( matrices == orthonormals );
+}
@@ -0,0 +1,113 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/preconditioner.h>
+
+namespace
+{
+// A tridiagonal matrix, whose LU and Cholesky decompositions have no fill-in.
+template < int N >
+linear::Matrix< N, N, double > Tridiagonal( double i_lower, double i_diagonal, double i_upper )
+{
+    linear::Matrix< N, N, double > matrix;
+    for ( int index = 0; index < N; ++index )
+    {
+        matrix( index, index ) = i_diagonal + 0.1 * index;
+        if ( index > 0 )
+        {
+            matrix( index, index - 1 ) = i_lower;
+        }
+        if ( index + 1 < N )
+        {
+            matrix( index, index + 1 ) = i_upper;
+        }
+    }
+    return matrix;
+}
+} // namespace
+
+TEST_CASE( "JacobiPreconditioner" )
+{
+    using MatrixT = linear::Matrix< 3, 3, double >;
+    using VectorT = linear::Matrix< 3, 1, double >;
+    const MatrixT matrix(
+        2.0, 1.0,  0.0,
+        1.0, 4.0,  1.0,
+        0.0, 1.0, -8.0
+    );
+
+    linear::JacobiPreconditioner< MatrixT > preconditioner;
+    CHECK( preconditioner.Setup( matrix ) );
+
+    VectorT result;
+    preconditioner.Apply( VectorT( 1.0, 1.0, 1.0 ), result );
+    CHECK( result == VectorT( 0.5, 0.25, -0.125 ) );
+
+    CHECK( !preconditioner.Setup( MatrixT( 1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0 ) ) );
+}
+
+TEST_CASE( "BlockJacobiPreconditioner" )
+{
+    using MatrixT = linear::Matrix< 6, 6, double >;
+    using VectorT = linear::Matrix< 6, 1, double >;
+    const MatrixT matrix(
+        2.0, 1.0, 0.0, 0.0,  0.0, 0.0,
+        1.0, 3.0, 0.0, 0.0,  0.0, 0.0,
+        0.0, 0.0, 4.0, -1.0, 0.0, 0.0,
+        0.0, 0.0, 2.0, 5.0,  0.0, 0.0,
+        0.0, 0.0, 0.0, 0.0,  1.0, 7.0,
+        0.0, 0.0, 0.0, 0.0,  2.0, 1.0
+    );
+    const VectorT vector( 1.0, -2.0, 3.0, 0.5, -1.0, 2.0 );
+
+    // The preconditioner of a block diagonal matrix is its exact inverse.
+    linear::BlockJacobiPreconditioner< MatrixT, 2 > preconditioner;
+    REQUIRE( preconditioner.Setup( matrix ) );
+    VectorT                                               result;
+    preconditioner.Apply( linear::Multiply( matrix, vector ), result );
+    CHECK( result == vector );
+
+    linear::BlockJacobiPreconditioner< MatrixT, 3 > singular;
+    CHECK( !singular.Setup( MatrixT() ) );
+}
+
+TEST_CASE( "IncompleteLUPreconditioner" )
+{
+    using MatrixT = linear::Matrix< 8, 8, double >;
+    using VectorT = linear::Matrix< 8, 1, double >;
+    const MatrixT matrix = Tridiagonal< 8 >( -1.4, 2.0, -0.6 );
+    const VectorT vector( 1.0, -2.0, 3.0, 0.5, -1.0, 2.0, 0.25, 4.0 );
+
+    // Without fill-in, the incomplete factorization is the complete one.
+    linear::IncompleteLUPreconditioner< MatrixT > preconditioner;
+    CHECK( preconditioner.Setup( matrix ) );
+    VectorT result;
+    preconditioner.Apply( linear::Multiply( matrix, vector ), result );
+    CHECK( result == vector );
+
+    // Re-factored for another matrix of the same pattern.
+    const MatrixT otherMatrix = Tridiagonal< 8 >( 0.5, -3.0, 1.5 );
+    CHECK( preconditioner.Factorize( otherMatrix ) );
+    preconditioner.Apply( linear::Multiply( otherMatrix, vector ), result );
+    CHECK( result == vector );
+
+    CHECK( !preconditioner.Factorize( MatrixT() ) );
+}
+
+TEST_CASE( "IncompleteCholeskyPreconditioner" )
+{
+    using MatrixT = linear::Matrix< 8, 8, double >;
+    using VectorT = linear::Matrix< 8, 1, double >;
+    const MatrixT matrix = Tridiagonal< 8 >( -1.0, 2.0, -1.0 );
+    const VectorT vector( 1.0, -2.0, 3.0, 0.5, -1.0, 2.0, 0.25, 4.0 );
+
+    // Without fill-in, the incomplete factorization is the complete one.
+    linear::IncompleteCholeskyPreconditioner< MatrixT > preconditioner;
+    CHECK( preconditioner.Setup( matrix ) );
+    VectorT result;
+    preconditioner.Apply( linear::Multiply( matrix, vector ), result );
+    CHECK( result == vector );
+
+    // Indefinite.
+    CHECK( !preconditioner.Factorize( Tridiagonal< 8 >( -3.0, 2.0, -3.0 ) ) );
+}
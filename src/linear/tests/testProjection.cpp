@@ -1,5 +1,6 @@
 #include <catch2/catch.hpp>
 
+#include <linear/multiply.h>
 #include <linear/projection.h>
 
 TEST_CASE( "Projection" )
@@ -51,3 +52,70 @@ TEST_CASE( "ProjectionMatrix" )
         )
     );
 }
+
+TEST_CASE( "ProjectionMatrix_DependentColumns" )
+{
+    CHECK( linear::ProjectionMatrix(
+        linear::Matrix< 3, 2 >(
+            1.0f, 2.0f,
+            0.0f, 0.0f,
+            0.0f, 0.0f
+        )
+    ) == linear::Matrix< 3, 3 >(
+            1.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f,
+            0.0f, 0.0f, 0.0f
+        )
+    );
+}
+
+TEST_CASE( "Projector" )
+{
+    using MatrixT = linear::Matrix< 4, 2 >;
+    using VectorT = linear::Matrix< 4, 1 >;
+    const MatrixT subspace(
+        1.0f, 1.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 2.0f
+    );
+    linear::Projector< MatrixT > projector( subspace );
+    CHECK( projector.Rank() == 2 );
+    CHECK( projector.ProjectionMatrix() == linear::ProjectionMatrix( subspace ) );
+
+    // Single vectors.
+    const VectorT vectors[] = {VectorT( 2.0f, 3.0f, 4.0f, 5.0f ), VectorT( -1.0f, 0.5f, 0.0f, 2.0f )};
+    for ( const VectorT& vector : vectors )
+    {
+        CHECK( projector.Project( vector ) == linear::Multiply( projector.ProjectionMatrix(), vector ) );
+        CHECK( projector.Project( projector.Project( vector ) ) == projector.Project( vector ) );
+    }
+    CHECK( projector.Project( linear::Matrix< 4, 1 >( 1.0f, 1.0f, 0.0f, 1.0f ) ) ==
+           linear::Matrix< 4, 1 >( 1.0f, 1.0f, 0.0f, 1.0f ) );
+
+    // Batches, as the columns of a matrix, or as an array of vectors.
+    const linear::Matrix< 4, 2 > batch(
+        2.0f, -1.0f,
+        3.0f, 0.5f,
+        4.0f, 0.0f,
+        5.0f, 2.0f
+    );
+    CHECK( projector.Project( batch ) == linear::Multiply( projector.ProjectionMatrix(), batch ) );
+
+    VectorT projections[ 2 ];
+    projector.Project( vectors, 2, projections );
+    CHECK( projections[ 0 ] == projector.Project( vectors[ 0 ] ) );
+    CHECK( projections[ 1 ] == projector.Project( vectors[ 1 ] ) );
+}
+
+TEST_CASE( "Projector_DependentColumns" )
+{
+    linear::Projector< linear::Matrix< 3, 2 > > projector( linear::Matrix< 3, 2 >(
+        1.0f, 2.0f,
+        1.0f, 2.0f,
+        0.0f, 0.0f
+    ) );
+    CHECK( projector.Rank() == 1 );
+    CHECK( projector.Project( linear::Matrix< 3, 1 >( 1.0f, 3.0f, 4.0f ) ) ==
+           linear::Matrix< 3, 1 >( 2.0f, 2.0f, 0.0f ) );
+}
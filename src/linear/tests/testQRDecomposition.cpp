@@ -0,0 +1,77 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/qrDecomposition.h>
+#include <linear/transpose.h>
+
+TEST_CASE( "QRDecomposition" )
+{
+    using MatrixT = linear::Matrix< 4, 3, double >;
+    MatrixT matrix(
+        1.0, 2.0, 0.0,
+        -1.0, 1.0, 3.0,
+        2.0, 0.0, 1.0,
+        0.5, -4.0, 2.0
+    );
+
+    linear::QRDecomposition< MatrixT > qr( matrix );
+    CHECK( qr.HasFullRank() );
+
+    MatrixT q = qr.Q();
+    CHECK( linear::Multiply( linear::Transpose( q ), q ) == linear::Matrix< 3, 3, double >::Identity() );
+    CHECK( linear::Multiply( q, qr.R() ) == matrix );
+
+    // Q^T * A = [R; 0]
+    MatrixT qtA = matrix;
+    qr.ApplyQT( qtA );
+    CHECK( qtA( 3, 0 ) == Approx( 0.0 ).margin( 1e-12 ) );
+    CHECK( qtA( 2, 1 ) == Approx( 0.0 ).margin( 1e-12 ) );
+    qr.ApplyQ( qtA );
+    CHECK( qtA == matrix );
+}
+
+TEST_CASE( "QRDecomposition_SolveLeastSquares" )
+{
+    // Fit a line y = c + d * t through points which do not lie on a line.
+    using MatrixT = linear::Matrix< 3, 2, double >;
+    MatrixT matrix(
+        1.0, 0.0,
+        1.0, 1.0,
+        1.0, 2.0
+    );
+    linear::Matrix< 3, 1, double > b( 6.0, 0.0, 0.0 );
+
+    linear::QRDecomposition< MatrixT > qr( matrix );
+    linear::Matrix< 2, 1, double > x;
+    CHECK( qr.SolveLeastSquares( b, x ) );
+    CHECK( x == linear::Matrix< 2, 1, double >( 5.0, -3.0 ) );
+
+    // Dependent columns.
+    linear::QRDecomposition< MatrixT > dependent( MatrixT(
+        1.0, 2.0,
+        1.0, 2.0,
+        1.0, 2.0
+    ) );
+    CHECK( !dependent.HasFullRank() );
+    CHECK( !dependent.SolveLeastSquares( b, x ) );
+}
+
+TEST_CASE( "QRDecomposition_Blocked" )
+{
+    using MatrixT = linear::Matrix< 6, 5, double >;
+    MatrixT matrix(
+        4.0, 1.0, -2.0, 0.5, 3.0,
+        1.0, 5.0, 1.0, -1.0, 0.0,
+        2.0, -3.0, 6.0, 2.0, 1.0,
+        0.0, 1.0, 2.0, 7.0, -2.0,
+        3.0, 0.0, -1.0, 1.0, 8.0,
+        1.0, 2.0, 3.0, 4.0, 5.0
+    );
+
+    // Panels of 2 columns, applied as blocks onto the trailing columns.
+    linear::QRDecomposition< MatrixT, 2 > blocked( matrix );
+    linear::QRDecomposition< MatrixT > unblocked( matrix );
+    CHECK( blocked.R() == unblocked.R() );
+    CHECK( blocked.Q() == unblocked.Q() );
+    CHECK( linear::Multiply( blocked.Q(), blocked.R() ) == matrix );
+}
@@ -2,6 +2,8 @@
 
 #include <linear/rank.h>
 
+#include <array>
+
 TEST_CASE( "Matrix_MaxRank" )
 {
     using MatrixT = linear::Matrix< 3, 4 >;
@@ -18,3 +20,81 @@ TEST_CASE( "Matrix_Rank" )
     );
     CHECK( linear::Rank( matrix ) == 2 );
 }
+
+TEST_CASE( "Matrix_Rank_Workspace" )
+{
+    using MatrixT = linear::Matrix< 3, 4 >;
+    linear::EliminationWorkspace< MatrixT > workspace;
+    MatrixT matrix(
+        1.0f, 2.0f, 2.0f, 2.0f,
+        2.0f, 4.0f, 6.0f, 8.0f,
+        3.0f, 6.0f, 8.0f, 10.0f
+    );
+    CHECK( linear::Rank( matrix, workspace ) == 2 );
+    CHECK( linear::Rank( matrix, workspace ) == 2 );
+}
+
+TEST_CASE( "Matrix_Rank_Tolerance" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+
+    // The third column is the sum of the first two, and the fourth is their difference, up to noise.
+    MatrixT matrix(
+        1.0, 2.0, 3.0 + 1e-12, -1.0,
+        4.0, 1.0, 5.0, 3.0 - 1e-12,
+        2.0, 7.0, 9.0, -5.0,
+        3.0, 3.0, 6.0 - 1e-12, 0.0 + 1e-12
+    );
+    CHECK( linear::Rank( matrix, 0.0 ) == 4 );
+    CHECK( linear::Rank( matrix, 1e-9 ) == 2 );
+
+    // The pivot columns are independent.
+    std::array< int, 4 > pivotColumns;
+    REQUIRE( linear::Rank( matrix, 1e-9, pivotColumns ) == 2 );
+    linear::Matrix< 4, 2, double > basis;
+    for ( size_t rowIndex = 0; rowIndex < 4; ++rowIndex )
+    {
+        basis( rowIndex, 0 ) = matrix( rowIndex, pivotColumns[ 0 ] );
+        basis( rowIndex, 1 ) = matrix( rowIndex, pivotColumns[ 1 ] );
+    }
+    CHECK( pivotColumns[ 0 ] != pivotColumns[ 1 ] );
+    CHECK( linear::Rank( basis, 1e-9 ) == 2 );
+
+    CHECK( linear::Rank( MatrixT(), 0.0 ) == 0 );
+}
+
+TEST_CASE( "Matrix_Rank_Tolerance_Wide" )
+{
+    using MatrixT = linear::Matrix< 3, 4 >;
+    MatrixT matrix(
+        1.0f, 2.0f, 2.0f, 2.0f,
+        2.0f, 4.0f, 6.0f, 8.0f,
+        3.0f, 6.0f, 8.0f, 10.0f
+    );
+
+    std::array< int, 3 > pivotColumns;
+    CHECK( linear::Rank( matrix, 1e-4f, pivotColumns ) == 2 );
+    CHECK( ( pivotColumns[ 0 ] == 3 ) );
+}
+
+TEST_CASE( "Matrix_Rank_Integral" )
+{
+    // Elimination would require fractions.
+    using MatrixT = linear::Matrix< 4, 5, int >;
+    const MatrixT matrix(
+        0, 3, 2, 7, 1,
+        0, 6, 4, 14, 2,
+        0, 2, 5, 1, 3,
+        0, 5, 7, 8, 4
+    );
+    CHECK( linear::Rank( matrix ) == 2 );
+
+    linear::EliminationWorkspace< MatrixT > workspace;
+    CHECK( linear::Rank( matrix, workspace ) == 2 );
+
+    size_t rank = 0;
+    CHECK( linear::TryRank( matrix, rank ) );
+    CHECK( rank == 2 );
+
+    CHECK( linear::Rank( MatrixT() ) == 0 );
+}
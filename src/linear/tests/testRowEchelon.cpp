@@ -33,3 +33,48 @@ TEST_CASE( "Matrix_ReducedRowEchelonForm" )
         0.0f, 0.0f, 0.0f, 0.0f
     ) );
 }
+
+TEST_CASE( "Matrix_RowEchelonForm_Workspace" )
+{
+    using MatrixT = linear::Matrix< 3, 4 >;
+    linear::EliminationWorkspace< MatrixT > workspace;
+    MatrixT matrix(
+        1.0f, 2.0f, 2.0f, 2.0f,
+        2.0f, 4.0f, 6.0f, 8.0f,
+        3.0f, 6.0f, 8.0f, 10.0f
+    );
+
+    MatrixT rowEchelonForm;
+    linear::RowEchelonForm( matrix, rowEchelonForm, workspace );
+    CHECK( rowEchelonForm == MatrixT(
+        1.0f, 2.0f, 2.0f, 2.0f,
+        0.0f, 0.0f, 2.0f, 4.0f,
+        0.0f, 0.0f, 0.0f, 0.0f
+    ) );
+
+    MatrixT reducedRowEchelonForm;
+    linear::ReducedRowEchelonForm( matrix, reducedRowEchelonForm, workspace );
+    CHECK( reducedRowEchelonForm == MatrixT(
+        1.0f, 2.0f, 0.0f, -2.0f,
+        0.0f, 0.0f, 1.0f, 2.0f,
+        0.0f, 0.0f, 0.0f, 0.0f
+    ) );
+}
+
+TEST_CASE( "Matrix_ReducedRowEchelonForm_PartialPivot" )
+{
+    // The reduced row echelon form is unique, regardless of the pivoting policy.
+    using MatrixT = linear::Matrix< 3, 4 >;
+    MatrixT matrix(
+        1.0f, 2.0f, 2.0f, 2.0f,
+        2.0f, 4.0f, 6.0f, 8.0f,
+        4.0f, 8.0f, 8.0f, 8.0f
+    );
+
+    CHECK( linear::ReducedRowEchelonForm< linear::PartialPivot >( matrix ) == MatrixT(
+        1.0f, 2.0f, 0.0f, -2.0f,
+        0.0f, 0.0f, 1.0f, 2.0f,
+        0.0f, 0.0f, 0.0f, 0.0f
+    ) );
+    CHECK( linear::Rank< linear::PartialPivot >( matrix ) == 2 );
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/singularValueDecomposition.h>
+#include <linear/taggedMatrix.h>
+#include <linear/transpose.h>
+
+template < typename MatrixT >
+static typename MatrixT::MatrixType Reconstruct( const linear::SingularValueDecomposition< MatrixT >& i_svd )
+{
+    return i_svd.LowRankApproximation( i_svd.SingularValues().RowCount() );
+}
+
+TEST_CASE( "SingularValueDecomposition_Square" )
+{
+    linear::Matrix< 3, 3 > matrix(
+        2.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, -3.0f,
+        0.0f, 1.0f, 0.0f
+    );
+    linear::SingularValueDecomposition< linear::Matrix< 3, 3 > > svd( matrix );
+    CHECK( svd.HasConverged() );
+    CHECK( svd.SingularValues() == linear::Matrix< 3, 1 >( 3.0f, 2.0f, 1.0f ) );
+    CHECK( linear::Orthonormal::Check( svd.U() ) );
+    CHECK( linear::Orthonormal::Check( svd.V() ) );
+    CHECK( Reconstruct( svd ) == matrix );
+    CHECK( svd.Rank() == 3 );
+}
+
+TEST_CASE( "SingularValueDecomposition_Tall" )
+{
+    linear::Matrix< 4, 2, double > matrix(
+        1.0, 2.0,
+        3.0, 4.0,
+        5.0, 6.0,
+        7.0, 8.0
+    );
+    linear::SingularValueDecomposition< linear::Matrix< 4, 2, double > > svd( matrix );
+    CHECK( svd.HasConverged() );
+    CHECK( svd.SingularValues() == linear::Matrix< 2, 1, double >( 14.2690955, 0.62682823 ) );
+    CHECK( linear::Multiply( linear::Transpose( svd.U() ), svd.U() ) == linear::Matrix< 2, 2, double >::Identity() );
+    CHECK( Reconstruct( svd ) == matrix );
+    CHECK( linear::Orthonormal::Check( svd.FullU() ) );
+    linear::Matrix< 4, 2, double > sigma(
+        svd.SingularValues()[ 0 ], 0.0,
+        0.0, svd.SingularValues()[ 1 ],
+        0.0, 0.0,
+        0.0, 0.0
+    );
+    CHECK( linear::Multiply( linear::Transpose( svd.FullU() ), matrix ) ==
+           linear::Multiply( sigma, linear::Transpose( svd.V() ) ) );
+
+    // The pseudo-inverse of a matrix with independent columns is its left inverse.
+    CHECK( linear::Multiply( svd.PseudoInverse(), matrix ) == linear::Matrix< 2, 2, double >::Identity() );
+    CHECK( linear::SingularValues( matrix ) == svd.SingularValues() );
+}
+
+TEST_CASE( "SingularValueDecomposition_RankDeficient" )
+{
+    // Rank 1, as every row is a multiple of the first.
+    linear::Matrix< 2, 3, double > matrix(
+        1.0, 2.0, 3.0,
+        2.0, 4.0, 6.0
+    );
+    linear::SingularValueDecomposition< linear::Matrix< 2, 3, double > > svd( matrix );
+    CHECK( svd.Rank() == 1 );
+    CHECK( svd.SingularValues()[ 0 ] == Approx( std::sqrt( 70.0 ) ) );
+    CHECK( svd.SingularValues()[ 1 ] == Approx( 0.0 ).margin( 1e-12 ) );
+    CHECK( linear::Orthonormal::Check( svd.U() ) );
+    CHECK( linear::Orthonormal::Check( svd.FullV() ) );
+    CHECK( svd.LowRankApproximation( 1 ) == matrix );
+    CHECK( linear::SingularValues( matrix ) == svd.SingularValues() );
+
+    // Moore-Penrose conditions.
+    linear::Matrix< 3, 2, double > pseudoInverse = svd.PseudoInverse();
+    CHECK( linear::Multiply( linear::Multiply( matrix, pseudoInverse ), matrix ) == matrix );
+    CHECK( linear::Multiply( linear::Multiply( pseudoInverse, matrix ), pseudoInverse ) == pseudoInverse );
+    CHECK( pseudoInverse == linear::Matrix< 3, 2, double >( 1.0, 2.0,
+                                                            2.0, 4.0,
+                                                            3.0, 6.0 ) * ( 1.0 / 70.0 ) );
+}
+
+TEST_CASE( "SingularValueDecomposition_LowRankApproximation" )
+{
+    linear::Matrix< 3, 3 > matrix(
+        3.0f, 0.0f, 0.0f,
+        0.0f, 2.0f, 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+    linear::SingularValueDecomposition< linear::Matrix< 3, 3 > > svd( matrix );
+    CHECK( svd.LowRankApproximation( 2 ) == linear::Matrix< 3, 3 >(
+        3.0f, 0.0f, 0.0f,
+        0.0f, 2.0f, 0.0f,
+        0.0f, 0.0f, 0.0f
+    ) );
+    CHECK( svd.Rank( 1.5f ) == 2 );
+}
@@ -1,7 +1,10 @@
 #include <catch2/catch.hpp>
 
+#include <linear/multiply.h>
 #include <linear/slice.h>
 
+#include <type_traits>
+
 TEST_CASE( "Slice" )
 {
     linear::Matrix< 3, 3 > matrix = linear::Matrix< 3, 3 >::Identity();
@@ -16,3 +19,86 @@ TEST_CASE( "Slice_constexpr" )
     static_assert( slice == linear::Matrix< 2, 2 >::Identity() );
 }
 
+TEST_CASE( "SliceView_Read" )
+{
+    const linear::Matrix< 3, 3 > matrix(
+        1.0f, 2.0f, 3.0f,
+        4.0f, 5.0f, 6.0f,
+        7.0f, 8.0f, 9.0f
+    );
+    size_t rowOffset = 1, columnOffset = 1;
+    linear::SliceView< 2, 2, const float > slice = linear::Slice< 2, 2 >( matrix, rowOffset, columnOffset );
+    CHECK( slice( 0, 0 ) == 5.0f );
+    CHECK( slice[ 3 ] == 9.0f );
+    CHECK( slice == linear::Matrix< 2, 2 >(
+        5.0f, 6.0f,
+        8.0f, 9.0f
+    ) );
+    CHECK( slice.GetColumn( 1 ) == linear::Matrix< 2, 1 >( 6.0f, 9.0f ) );
+
+    linear::Matrix< 2, 2 > copy = slice;
+    CHECK( copy == linear::Matrix< 2, 2 >(
+        5.0f, 6.0f,
+        8.0f, 9.0f
+    ) );
+}
+
+TEST_CASE( "SliceView_Write" )
+{
+    linear::Matrix< 4, 4 > matrix;
+    linear::Slice< 2, 2 >( matrix, 2, 1 ) = linear::Matrix< 2, 2 >::Identity();
+    CHECK( matrix == linear::Matrix< 4, 4 >(
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f
+    ) );
+
+    // Nested slices share the storage of the parent matrix.
+    linear::SliceView< 3, 3, float > block = linear::Slice< 3, 3 >( matrix, 1, 1 );
+    linear::Slice< 1, 2 >( block, 0, 1 ) = linear::Matrix< 1, 2 >( 2.0f, 3.0f );
+    block *= 2.0f;
+    CHECK( matrix == linear::Matrix< 4, 4 >(
+        0.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 4.0f, 6.0f,
+        0.0f, 2.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 2.0f, 0.0f
+    ) );
+}
+
+TEST_CASE( "SliceView_Operations" )
+{
+    linear::Matrix< 4, 4 > matrix(
+        1.0f, 2.0f, 0.0f, 0.0f,
+        3.0f, 4.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+    linear::SliceView< 2, 2, float > upperLeft  = linear::Slice< 2, 2 >( matrix, 0, 0 );
+    linear::SliceView< 2, 2, float > lowerRight = linear::Slice< 2, 2 >( matrix, 2, 2 );
+    lowerRight -= linear::Multiply( upperLeft, upperLeft );
+    CHECK( lowerRight == linear::Matrix< 2, 2 >(
+        -6.0f, -10.0f,
+        -15.0f, -21.0f
+    ) );
+}
+
+TEST_CASE( "SliceView_Temporary" )
+{
+    const linear::Matrix< 3, 3 > matrix(
+        1.0f, 2.0f, 3.0f,
+        4.0f, 5.0f, 6.0f,
+        7.0f, 8.0f, 9.0f
+    );
+
+    // The block of a temporary owns its entries, rather than referencing the destroyed matrix.
+    auto slice = linear::Slice< 2, 2 >( linear::Multiply( matrix, linear::Matrix< 3, 3 >::Identity() ), 1, 1 );
+    static_assert( std::is_same< decltype( slice ), linear::Matrix< 2, 2 > >::value );
+    CHECK( slice == linear::Matrix< 2, 2 >(
+        5.0f, 6.0f,
+        8.0f, 9.0f
+    ) );
+
+    static_assert( std::is_same< decltype( linear::Slice< 2, 2 >( matrix, 1, 1 ) ),
+                                 linear::SliceView< 2, 2, const float > >::value );
+}
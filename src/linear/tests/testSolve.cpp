@@ -0,0 +1,178 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/slice.h>
+#include <linear/solve.h>
+#include <linear/transpose.h>
+
+TEST_CASE( "Matrix_Solve" )
+{
+    using MatrixT = linear::Matrix< 4, 4, double >;
+    MatrixT matrix(
+        0.0, 7.0, 0.25, 8.0,
+        1.0, 5.0, 8.0, 9.0,
+        2.0, -3.0, 1.0, 1.3,
+        8.0, 1.0, 2.0, 1.3
+    );
+
+    // Single right-hand side.
+    linear::Matrix< 4, 1, double > b( 1.0, 2.0, 3.0, 4.0 );
+    linear::Matrix< 4, 1, double > x;
+    CHECK( linear::Solve( matrix, b, x ) );
+    CHECK( linear::Multiply( matrix, x ) == b );
+
+    // Many right-hand sides.
+    linear::Matrix< 4, 2, double > B(
+        1.0, -1.0,
+        2.0, 0.5,
+        3.0, 2.0,
+        4.0, 0.0
+    );
+    linear::Matrix< 4, 2, double > X;
+    CHECK( linear::Solve< linear::PartialPivot >( matrix, B, X ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+
+    // Re-use of a workspace.
+    linear::EliminationWorkspace< MatrixT > workspace;
+    CHECK( linear::Solve( matrix, B, X, workspace ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+}
+
+TEST_CASE( "Matrix_Solve_Singular" )
+{
+    linear::Matrix< 3, 3 > singular(
+        1.0f, 2.0f, 3.0f,
+        2.0f, 4.0f, 6.0f,
+        0.0f, 1.0f, 1.0f
+    );
+    linear::Matrix< 3, 1 > b( 1.0f, 2.0f, 3.0f );
+    linear::Matrix< 3, 1 > x;
+    CHECK( !linear::Solve( singular, b, x ) );
+}
+
+TEST_CASE( "Matrix_Solve_NoPivot" )
+{
+    linear::Matrix< 3, 3 > matrix(
+        4.0f, 1.0f, 0.0f,
+        1.0f, 4.0f, 1.0f,
+        0.0f, 1.0f, 4.0f
+    );
+    linear::Matrix< 3, 1 > b( 5.0f, 6.0f, 5.0f );
+    linear::Matrix< 3, 1 > x;
+    REQUIRE( linear::Solve< linear::NoPivot >( matrix, b, x ) );
+    CHECK( x == linear::Matrix< 3, 1 >( 1.0f, 1.0f, 1.0f ) );
+
+    // Without row exchanges, a zero pivot is reported as singular.
+    linear::Matrix< 3, 3 > permutation(
+        0.0f, 1.0f, 0.0f,
+        1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+    CHECK( !linear::Solve< linear::NoPivot >( permutation, b, x ) );
+    CHECK( linear::Solve( permutation, b, x ) );
+}
+
+TEST_CASE( "Matrix_SolveRefined" )
+{
+    using MatrixT = linear::Matrix< 5, 5, double >;
+    using VectorT = linear::Matrix< 5, 1, double >;
+    const MatrixT matrix(
+        1.0, 7.0, 0.0,  8.0,   0.0,
+        5.0, 8.0, 9.0,  2.0,  -3.0,
+        9.0, 0.0, 1.0,  23.0, -2.0,
+        0.0, 1.0, 1.0,  0.0,  -9.0,
+        1.0, 8.0, 1.0,  2.0,   1.3
+    );
+    const VectorT b( 1.0, 2.0, 3.0, 4.0, 5.0 );
+
+    VectorT expected;
+    REQUIRE( linear::Solve< linear::PartialPivot >( matrix, b, expected ) );
+
+    // Refined from the single precision solution to the double precision one.
+    VectorT x;
+    int     iterationCount = 0;
+    CHECK( linear::SolveRefined( matrix, b, x, iterationCount ) );
+    CHECK( iterationCount > 0 );
+    CHECK( iterationCount < linear::_REFINEMENT_MAX_ITERATIONS );
+    for ( int index = 0; index < 5; ++index )
+    {
+        CHECK( x[ index ] == Approx( expected[ index ] ).epsilon( 1e-12 ) );
+    }
+
+    // Many right-hand sides.
+    const linear::Matrix< 5, 2, double > B(
+        1.0, -1.0,
+        2.0,  0.5,
+        3.0,  2.0,
+        4.0,  0.0,
+        5.0,  1.0
+    );
+    linear::Matrix< 5, 2, double > X;
+    CHECK( linear::SolveRefined( matrix, B, X ) );
+    CHECK( linear::Multiply( matrix, X ) == B );
+}
+
+TEST_CASE( "Matrix_SolveRefined_View" )
+{
+    using VectorT = linear::Matrix< 3, 1, double >;
+    const linear::Matrix< 4, 4, double > matrix(
+        2.0, 9.0, 0.0, 7.0,
+        0.0, 2.0, 9.0, 7.0,
+        1.0, 0.0, 2.0, 7.0,
+        7.0, 7.0, 7.0, 7.0
+    );
+    const VectorT b( 1.0, 2.0, 3.0 );
+
+    // The transpose is refined rather than solved by the full precision fallback.
+    const linear::Matrix< 3, 3, double > upperLeft = linear::Slice< 0, 0, 3, 3 >( matrix );
+    VectorT expected;
+    VectorT x;
+    int     iterationCount = 0;
+    REQUIRE( linear::Solve< linear::PartialPivot >( linear::Transpose( upperLeft ), b, expected ) );
+    CHECK( linear::SolveRefined( linear::Transpose( upperLeft ), b, x, iterationCount ) );
+    CHECK( iterationCount >= 0 );
+    CHECK( x == expected );
+
+    // As is a slice, whose rows are strided by those of its parent.
+    REQUIRE( linear::Solve< linear::PartialPivot >( upperLeft, b, expected ) );
+    CHECK( linear::SolveRefined( linear::Slice< 3, 3 >( matrix, 0, 0 ), b, x, iterationCount ) );
+    CHECK( iterationCount >= 0 );
+    CHECK( x == expected );
+}
+
+TEST_CASE( "Matrix_SolveRefined_Fallback" )
+{
+    // The Hilbert matrix is too ill-conditioned for single precision.
+    using MatrixT = linear::Matrix< 8, 8, double >;
+    using VectorT = linear::Matrix< 8, 1, double >;
+    MatrixT hilbert;
+    VectorT expected;
+    for ( int rowIndex = 0; rowIndex < 8; ++rowIndex )
+    {
+        for ( int columnIndex = 0; columnIndex < 8; ++columnIndex )
+        {
+            hilbert( rowIndex, columnIndex ) = 1.0 / ( rowIndex + columnIndex + 1 );
+        }
+        expected[ rowIndex ] = 1.0;
+    }
+    const VectorT b = linear::Multiply( hilbert, expected );
+
+    VectorT x;
+    int     iterationCount = 0;
+    CHECK( linear::SolveRefined( hilbert, b, x, iterationCount ) );
+    CHECK( iterationCount == -1 );
+    for ( int index = 0; index < 8; ++index )
+    {
+        CHECK( x[ index ] == Approx( 1.0 ).epsilon( 1e-4 ) );
+    }
+
+    // Singular in any precision.
+    const linear::Matrix< 3, 3, double > singular(
+        1.0, 2.0, 3.0,
+        2.0, 4.0, 6.0,
+        0.0, 1.0, 1.0
+    );
+    linear::Matrix< 3, 1, double > y;
+    CHECK( !linear::SolveRefined( singular, linear::Matrix< 3, 1, double >( 1.0, 2.0, 3.0 ), y, iterationCount ) );
+    CHECK( iterationCount == -1 );
+}
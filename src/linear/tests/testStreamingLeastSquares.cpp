@@ -0,0 +1,177 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/qrDecomposition.h>
+#include <linear/streamingLeastSquares.h>
+#include <linear/transpose.h>
+
+#include <cmath>
+
+namespace
+{
+// An observation of a noisy quadratic at sample i.
+linear::Matrix< 1, 3, double > SampleRow( int i_sample )
+{
+    const double t = 0.25 * i_sample;
+    return linear::Matrix< 1, 3, double >( 1.0, t, t * t );
+}
+
+double SampleValue( int i_sample )
+{
+    const double t = 0.25 * i_sample;
+    return 2.0 - 0.5 * t + 0.125 * t * t + 0.01 * std::sin( 3.0 * i_sample );
+}
+} // namespace
+
+TEST_CASE( "StreamingLeastSquares_SlidingWindow" )
+{
+    constexpr int                                      WINDOW = 8;
+    linear::StreamingLeastSquares< 3, WINDOW, double > fit;
+
+    linear::Matrix< 3, 1, double > solution;
+    fit.AppendRow( SampleRow( 0 ), SampleValue( 0 ) );
+    CHECK( !fit.Solve( solution ) );
+
+    for ( int sample = 1; sample < 40; ++sample )
+    {
+        fit.AppendRow( SampleRow( sample ), SampleValue( sample ) );
+        CHECK( fit.RowCount() == std::min( sample + 1, WINDOW ) );
+        if ( fit.RowCount() < WINDOW )
+        {
+            continue;
+        }
+
+        // Against the least squares solution of the window, factored from scratch.
+        linear::Matrix< WINDOW, 3, double > matrix;
+        linear::Matrix< WINDOW, 1, double > rhs;
+        for ( int rowIndex = 0; rowIndex < WINDOW; ++rowIndex )
+        {
+            const int windowSample = sample - WINDOW + 1 + rowIndex;
+            for ( int columnIndex = 0; columnIndex < 3; ++columnIndex )
+            {
+                matrix( rowIndex, columnIndex ) = SampleRow( windowSample )[ columnIndex ];
+            }
+            rhs[ rowIndex ] = SampleValue( windowSample );
+        }
+
+        linear::Matrix< 3, 1, double > expected;
+        REQUIRE( linear::QRDecomposition< decltype( matrix ) >( matrix ).SolveLeastSquares( rhs, expected ) );
+        REQUIRE( fit.Solve( solution ) );
+        CHECK( solution == expected );
+
+        const linear::Matrix< WINDOW, 1, double > residual = linear::Multiply( matrix, expected ) - rhs;
+        const double residualNorm = std::sqrt( linear::Multiply( linear::Transpose( residual ), residual )[ 0 ] );
+        CHECK( fit.ResidualNorm() == Approx( residualNorm ).margin( 1e-9 ) );
+    }
+}
+
+TEST_CASE( "StreamingLeastSquares_AppendColumn" )
+{
+    linear::StreamingLeastSquares< 3, 6, double > fit( 2 );
+    linear::Matrix< 6, 1, double >                column;
+    for ( int sample = 0; sample < 6; ++sample )
+    {
+        fit.AppendRow( SampleRow( sample ), SampleValue( sample ) );
+        column[ sample ] = SampleRow( sample )[ 2 ];
+    }
+
+    // The first column is a multiple of itself.
+    CHECK( !fit.AppendColumn( linear::Matrix< 6, 1, double >( 2.0, 2.0, 2.0, 2.0, 2.0, 2.0 ) ) );
+    CHECK( fit.ColumnCount() == 2 );
+
+    REQUIRE( fit.AppendColumn( column ) );
+    CHECK( fit.ColumnCount() == 3 );
+    CHECK( !fit.AppendColumn( column ) );
+
+    // Equivalent to the fit with all the columns from the start.
+    linear::StreamingLeastSquares< 3, 6, double > reference;
+    for ( int sample = 0; sample < 6; ++sample )
+    {
+        reference.AppendRow( SampleRow( sample ), SampleValue( sample ) );
+    }
+
+    linear::Matrix< 3, 1, double > solution;
+    linear::Matrix< 3, 1, double > expected;
+    REQUIRE( fit.Solve( solution ) );
+    REQUIRE( reference.Solve( expected ) );
+    CHECK( solution == expected );
+    CHECK( fit.ResidualNorm() == Approx( reference.ResidualNorm() ).margin( 1e-9 ) );
+
+    // Rows appended afterwards include the new column.
+    fit.AppendRow( SampleRow( 6 ), SampleValue( 6 ) );
+    reference.AppendRow( SampleRow( 6 ), SampleValue( 6 ) );
+    REQUIRE( fit.Solve( solution ) );
+    REQUIRE( reference.Solve( expected ) );
+    CHECK( solution == expected );
+}
+
+TEST_CASE( "StreamingLeastSquares_RemoveRow" )
+{
+    linear::StreamingLeastSquares< 3, 8, double > fit;
+    CHECK( !fit.RemoveRow() );
+    for ( int sample = 0; sample < 5; ++sample )
+    {
+        fit.AppendRow( SampleRow( sample ), SampleValue( sample ) );
+    }
+
+    CHECK( fit.RemoveRow() );
+    CHECK( fit.RemoveRow() );
+    CHECK( fit.RowCount() == 3 );
+
+    // The three remaining rows are interpolated exactly.
+    linear::Matrix< 3, 1, double > solution;
+    REQUIRE( fit.Solve( solution ) );
+    for ( int sample = 2; sample < 5; ++sample )
+    {
+        CHECK( linear::Multiply( SampleRow( sample ), solution )[ 0 ] == Approx( SampleValue( sample ) ) );
+    }
+}
+
+TEST_CASE( "StreamingLeastSquares_ExactFit" )
+{
+    // Observations of the quadratic without noise, whose residual norm vanishes.
+    constexpr int                                      WINDOW = 16;
+    linear::StreamingLeastSquares< 3, WINDOW, double > fit;
+    linear::Matrix< 3, 1, double >                     solution;
+    for ( int sample = 0; sample < 200; ++sample )
+    {
+        const double t = 0.25 * sample;
+        fit.AppendRow( SampleRow( sample ), 2.0 - 0.5 * t + 0.125 * t * t );
+        if ( sample >= WINDOW )
+        {
+            REQUIRE( fit.Solve( solution ) );
+            CHECK( solution[ 0 ] == Approx( 2.0 ) );
+            CHECK( solution[ 1 ] == Approx( -0.5 ) );
+            CHECK( solution[ 2 ] == Approx( 0.125 ) );
+            CHECK( fit.ResidualNorm() == Approx( 0.0 ).margin( 1e-8 ) );
+        }
+    }
+}
+
+TEST_CASE( "StreamingLeastSquares_ColumnBound" )
+{
+    // Both ends of the column count accepted by the constructor.
+    CHECK( linear::StreamingLeastSquares< 3, 6, double >( 0 ).ColumnCount() == 0 );
+    CHECK( linear::StreamingLeastSquares< 3, 6, double >( 3 ).ColumnCount() == 3 );
+
+    // Grow from no columns up to the maximum, past which columns are refused.
+    linear::StreamingLeastSquares< 3, 6, double > fit( 0 );
+    linear::Matrix< 6, 1, double >                columns[ 3 ];
+    for ( int sample = 0; sample < 6; ++sample )
+    {
+        fit.AppendRow( SampleRow( sample ), SampleValue( sample ) );
+        for ( int column = 0; column < 3; ++column )
+        {
+            columns[ column ][ sample ] = SampleRow( sample )[ column ];
+        }
+    }
+
+    for ( int column = 0; column < 3; ++column )
+    {
+        REQUIRE( fit.AppendColumn( columns[ column ] ) );
+        CHECK( fit.ColumnCount() == column + 1 );
+    }
+
+    CHECK( !fit.AppendColumn( linear::Matrix< 6, 1, double >( 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 ) ) );
+    CHECK( fit.ColumnCount() == 3 );
+}
@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include <linear/multiply.h>
+#include <linear/symmetricEigenDecomposition.h>
+#include <linear/taggedMatrix.h>
+#include <linear/transpose.h>
+
+#include <vector>
+
+template < typename MatrixT >
+static MatrixT Reconstruct( const linear::SymmetricEigenDecomposition< MatrixT >& i_eigen )
+{
+    MatrixT eigenvalues;
+    for ( int index = 0; index < MatrixT::RowCount(); ++index )
+    {
+        eigenvalues( index, index ) = i_eigen.Eigenvalues()[ index ];
+    }
+    return linear::Multiply( linear::Multiply( i_eigen.Eigenvectors(), eigenvalues ),
+                             linear::Transpose( i_eigen.Eigenvectors() ) );
+}
+
+TEST_CASE( "SymmetricEigenDecomposition_3x3" )
+{
+    linear::Matrix< 3, 3 > matrix(
+        2.0f, 1.0f, 0.0f,
+        1.0f, 2.0f, 0.0f,
+        0.0f, 0.0f, 5.0f
+    );
+    linear::SymmetricEigenDecomposition< linear::Matrix< 3, 3 > > eigen( matrix );
+    CHECK( eigen.HasConverged() );
+    CHECK( eigen.Eigenvalues() == linear::Matrix< 3, 1 >( 1.0f, 3.0f, 5.0f ) );
+    CHECK( linear::Orthonormal::Check( eigen.Eigenvectors() ) );
+    CHECK( Reconstruct( eigen ) == matrix );
+}
+
+TEST_CASE( "SymmetricEigenDecomposition_LowerTriangle" )
+{
+    linear::Matrix< 2, 2, double > matrix(
+        4.0, 99.0,
+        3.0, 4.0
+    );
+    linear::SymmetricEigenDecomposition< linear::Matrix< 2, 2, double > > eigen( matrix );
+    CHECK( eigen.Eigenvalues() == linear::Matrix< 2, 1, double >( 1.0, 7.0 ) );
+}
+
+TEST_CASE( "SymmetricEigenDecomposition_8x8" )
+{
+    // Large enough for the tolerance driven iteration.
+    linear::Matrix< 8, 8, double > matrix;
+    for ( int rowIndex = 0; rowIndex < 8; ++rowIndex )
+    {
+        for ( int columnIndex = 0; columnIndex < 8; ++columnIndex )
+        {
+            matrix( rowIndex, columnIndex ) = 1.0 / ( 1 + rowIndex + columnIndex ) + ( rowIndex == columnIndex );
+        }
+    }
+
+    linear::SymmetricEigenDecomposition< linear::Matrix< 8, 8, double > > eigen( matrix );
+    CHECK( eigen.HasConverged() );
+    CHECK( linear::Orthonormal::Check( eigen.Eigenvectors() ) );
+    CHECK( Reconstruct( eigen ) == matrix );
+    for ( int index = 1; index < 8; ++index )
+    {
+        CHECK( eigen.Eigenvalues()[ index - 1 ] <= eigen.Eigenvalues()[ index ] );
+    }
+}
+
+TEST_CASE( "SymmetricEigen_Batch" )
+{
+    std::vector< linear::Matrix< 3, 3 > > matrices;
+    for ( int matrixIndex = 0; matrixIndex < 11; ++matrixIndex )
+    {
+        const float offset = 0.25f * matrixIndex;
+        matrices.push_back( linear::Matrix< 3, 3 >(
+            4.0f + offset, 1.0f, -offset,
+            1.0f, 3.0f, 0.5f,
+            -offset, 0.5f, 1.0f
+        ) );
+    }
+    matrices[ 3 ] = linear::Matrix< 3, 3 >::Identity();
+
+    // Only the lower triangle is read, as by SymmetricEigenDecomposition.
+    matrices[ 5 ]( 0, 2 ) = 99.0f;
+
+    std::vector< linear::Matrix< 3, 1 > > eigenvalues( matrices.size() );
+    std::vector< linear::Matrix< 3, 3 > > eigenvectors( matrices.size() );
+    linear::SymmetricEigen( matrices.data(), matrices.size(), eigenvalues.data(), eigenvectors.data() );
+
+    for ( size_t matrixIndex = 0; matrixIndex < matrices.size(); ++matrixIndex )
+    {
+        linear::SymmetricEigenDecomposition< linear::Matrix< 3, 3 > > eigen( matrices[ matrixIndex ] );
+        CHECK( eigenvalues[ matrixIndex ] == eigen.Eigenvalues() );
+        CHECK( linear::Orthonormal::Check( eigenvectors[ matrixIndex ] ) );
+
+        linear::Matrix< 3, 3 > symmetric = matrices[ matrixIndex ];
+        symmetric( 0, 2 )                = symmetric( 2, 0 );
+        CHECK( linear::Multiply( symmetric, eigenvectors[ matrixIndex ] ) ==
+               linear::Multiply( eigenvectors[ matrixIndex ],
+                                 linear::Matrix< 3, 3 >( eigenvalues[ matrixIndex ][ 0 ], 0.0f, 0.0f,
+                                                         0.0f, eigenvalues[ matrixIndex ][ 1 ], 0.0f,
+                                                         0.0f, 0.0f, eigenvalues[ matrixIndex ][ 2 ] ) ) );
+    }
+}
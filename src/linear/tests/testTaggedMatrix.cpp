@@ -0,0 +1,63 @@
+#include <catch2/catch.hpp>
+
+#include <linear/inverse.h>
+#include <linear/multiply.h>
+#include <linear/taggedMatrix.h>
+
+#include <cmath>
+
+TEST_CASE( "TaggedMatrix_Orthonormal" )
+{
+    const float angle = 0.5f;
+    linear::Matrix< 3, 3 > rotation(
+        std::cos( angle ), -std::sin( angle ), 0.0f,
+        std::sin( angle ), std::cos( angle ), 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+    CHECK( linear::Orthonormal::Check( rotation ) );
+    CHECK( !linear::Orthonormal::Check( linear::Matrix< 3, 3 >( 2.0f, 0.0f, 0.0f,
+                                                                0.0f, 1.0f, 0.0f,
+                                                                0.0f, 0.0f, 1.0f ) ) );
+
+    linear::OrthonormalMatrix< linear::Matrix< 3, 3 > > tagged;
+    CHECK( tagged == linear::Matrix< 3, 3 >::Identity() );
+    REQUIRE( linear::MakeTaggedMatrix< linear::Orthonormal >( rotation, tagged ) );
+    CHECK( tagged == rotation );
+    CHECK( tagged( 0, 1 ) == rotation( 0, 1 ) );
+    CHECK( tagged.GetRow( 1 ) == rotation.GetRow( 1 ) );
+
+    linear::Matrix< 3, 3 > inverse;
+    REQUIRE( linear::Inverse( tagged, inverse ) );
+    CHECK( linear::Multiply( rotation, inverse ) == linear::Matrix< 3, 3 >::Identity() );
+}
+
+TEST_CASE( "TaggedMatrix_Rigid" )
+{
+    linear::Matrix< 4, 4 > transform(
+        0.0f, -1.0f, 0.0f, 1.0f,
+        1.0f, 0.0f, 0.0f, 2.0f,
+        0.0f, 0.0f, 1.0f, 3.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+    CHECK( linear::Rigid::Check( transform ) );
+    CHECK( !linear::Orthonormal::Check( transform ) );
+
+    linear::Matrix< 4, 4 > projective = transform;
+    projective( 3, 0 ) = 1.0f;
+    CHECK( !linear::Rigid::Check( projective ) );
+
+    linear::RigidMatrix< linear::Matrix< 4, 4 > > tagged;
+    CHECK( !linear::MakeTaggedMatrix< linear::Rigid >( projective, tagged ) );
+    CHECK( tagged == linear::Matrix< 4, 4 >::Identity() );
+    REQUIRE( linear::MakeTaggedMatrix< linear::Rigid >( transform, tagged ) );
+
+    linear::Matrix< 4, 4 > inverse;
+    REQUIRE( linear::Inverse( tagged, inverse ) );
+    CHECK( inverse == linear::Matrix< 4, 4 >(
+        0.0f, 1.0f, 0.0f, -2.0f,
+        -1.0f, 0.0f, 0.0f, 1.0f,
+        0.0f, 0.0f, 1.0f, -3.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    ) );
+    CHECK( linear::Multiply( inverse, transform ) == linear::Matrix< 4, 4 >::Identity() );
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch.hpp>
+
+#include <linear/taskPool.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+TEST_CASE( "TaskPool_Dependencies" )
+{
+    for ( size_t threadCount : {1, 2, 4} )
+    {
+        linear::TaskPool pool( threadCount );
+        CHECK( pool.ThreadCount() == threadCount );
+
+        // A chain of tasks, each appending its index, must run in order.
+        std::mutex         mutex;
+        std::vector< int > order;
+        linear::TaskGraph  graph;
+        for ( int taskIndex = 0; taskIndex < 32; ++taskIndex )
+        {
+            linear::TaskGraph::TaskIndex task = graph.AddTask( [ &, taskIndex ]() {
+                std::lock_guard< std::mutex > lock( mutex );
+                order.push_back( taskIndex );
+            } );
+            if ( taskIndex > 0 )
+            {
+                graph.AddDependency( task - 1, task );
+            }
+        }
+        pool.Run( graph );
+
+        REQUIRE( order.size() == 32 );
+        for ( int taskIndex = 0; taskIndex < 32; ++taskIndex )
+        {
+            CHECK( order[ taskIndex ] == taskIndex );
+        }
+
+        // A fan-out and fan-in, where the final task observes every independent task, run repeatedly on the pool.
+        for ( int runIndex = 0; runIndex < 8; ++runIndex )
+        {
+            std::atomic< int > counter{0};
+            int                observed = 0;
+
+            linear::TaskGraph            fanGraph;
+            linear::TaskGraph::TaskIndex first = fanGraph.AddTask( []() {} );
+            linear::TaskGraph::TaskIndex last  = fanGraph.AddTask( [ & ]() { observed = counter; } );
+            for ( int taskIndex = 0; taskIndex < 100; ++taskIndex )
+            {
+                linear::TaskGraph::TaskIndex task = fanGraph.AddTask( [ & ]() { counter++; } );
+                fanGraph.AddDependency( first, task );
+                fanGraph.AddDependency( task, last );
+            }
+            pool.Run( fanGraph );
+            CHECK( observed == 100 );
+        }
+    }
+}
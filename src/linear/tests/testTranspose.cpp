@@ -4,6 +4,8 @@
 #include <linear/matrix.h>
 #include <linear/transpose.h>
 
+#include <type_traits>
+
 TEST_CASE( "Matrix_Transpose" )
 {
     linear::Matrix< 3, 2 > matrix(
@@ -30,3 +32,27 @@ TEST_CASE( "Matrix_Transpose_constexpr" )
         2.0f, 1.0f, 2.0f
     ) );
 }
+
+TEST_CASE( "Matrix_Transpose_Temporary" )
+{
+    using MatrixT = linear::Matrix< 3, 2 >;
+    const auto makeMatrix = []() {
+        return MatrixT(
+            1.0f, 2.0f,
+            1.0f, 1.0f,
+            2.0f, 2.0f
+        );
+    };
+
+    // The transpose of a temporary owns its entries, rather than referencing the destroyed matrix.
+    auto transpose = linear::Transpose( makeMatrix() );
+    static_assert( std::is_same< decltype( transpose ), linear::Matrix< 2, 3 > >::value );
+    CHECK( transpose == linear::Matrix< 2, 3 >(
+        1.0f, 1.0f, 2.0f,
+        2.0f, 1.0f, 2.0f
+    ) );
+
+    const MatrixT matrix = makeMatrix();
+    static_assert( std::is_same< decltype( linear::Transpose( matrix ) ), linear::TransposeView< MatrixT > >::value );
+    CHECK( &linear::Transpose( linear::Transpose( matrix ) ) == &matrix );
+}
@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+
+#include <linear/inverse.h>
+#include <linear/multiply.h>
+#include <linear/transpose.h>
+
+TEST_CASE( "TransposeView_EntryAccess" )
+{
+    linear::Matrix< 3, 2 > matrix(
+        1.0f, 2.0f,
+        3.0f, 4.0f,
+        5.0f, 6.0f
+    );
+    linear::TransposeView< linear::Matrix< 3, 2 > > view( matrix );
+    CHECK( view.RowCount() == 2 );
+    CHECK( view.ColumnCount() == 3 );
+    CHECK( view( 0, 2 ) == 5.0f );
+    CHECK( view( 1, 0 ) == 2.0f );
+    CHECK( view[ 4 ] == 4.0f );
+    CHECK( view.GetRow( 1 ) == linear::Matrix< 1, 3 >( 2.0f, 4.0f, 6.0f ) );
+    CHECK( view.GetColumn( 2 ) == linear::Matrix< 2, 1 >( 5.0f, 6.0f ) );
+
+    // The view references the source matrix.
+    matrix( 2, 1 ) = 7.0f;
+    CHECK( view( 1, 2 ) == 7.0f );
+}
+
+TEST_CASE( "TransposeView_Materialize" )
+{
+    linear::Matrix< 3, 2 > matrix(
+        1.0f, 2.0f,
+        3.0f, 4.0f,
+        5.0f, 6.0f
+    );
+
+    linear::Matrix< 2, 3 > transpose = linear::Transpose( matrix );
+    CHECK( transpose == linear::Matrix< 2, 3 >(
+        1.0f, 3.0f, 5.0f,
+        2.0f, 4.0f, 6.0f
+    ) );
+
+    linear::Matrix< 3, 2 > original;
+    original = linear::Transpose( linear::Transpose( matrix ) );
+    CHECK( original == matrix );
+}
+
+TEST_CASE( "TransposeView_Materialize_constexpr" )
+{
+    constexpr linear::Matrix< 2, 2 > matrix(
+        1.0f, 2.0f,
+        3.0f, 4.0f
+    );
+    constexpr linear::Matrix< 2, 2 > transpose = linear::Transpose( matrix );
+    static_assert( transpose == linear::Matrix< 2, 2 >(
+        1.0f, 3.0f,
+        2.0f, 4.0f
+    ) );
+}
+
+TEST_CASE( "TransposeView_Operations" )
+{
+    linear::Matrix< 3, 2 > matrix(
+        1.0f, 2.0f,
+        0.0f, 1.0f,
+        2.0f, 0.0f
+    );
+    CHECK( linear::Multiply( linear::Transpose( matrix ), matrix ) == linear::Matrix< 2, 2 >(
+        5.0f, 2.0f,
+        2.0f, 5.0f
+    ) );
+
+    linear::Matrix< 2, 2 > square(
+        1.0f, 2.0f,
+        3.0f, 4.0f
+    );
+    linear::Matrix< 2, 2 > inverse;
+    CHECK( linear::Inverse( linear::Transpose( square ), inverse ) );
+    CHECK( linear::Multiply( linear::Transpose( square ), inverse ) == linear::Matrix< 2, 2 >::Identity() );
+}
@@ -11,26 +11,76 @@
 /// - the rows of the original matrix become the columns of the transposed matrix.
 /// - for each entry (i, j) in the original matrix, the corresponding transposed entry is (j, i)./
 
-#include <linear/base/matrixTranspose.h>
-
 #include <linear/linear.h>
 #include <linear/matrix.h>
+#include <linear/transposeView.h>
 
 LINEAR_NS_OPEN
 
 /// Find transpose of \p i_matrix.
 /// \ingroup LinearAlgebra_Operations
 ///
+/// The transpose is returned as a \ref TransposeView referencing \p i_matrix, thus no entries are copied until
+/// the view is assigned to a \ref Matrix.  The view must not outlive \p i_matrix; temporaries are transposed into
+/// a \ref Matrix instead, see the rvalue overload.
+///
 /// \tparam MatrixT The input matrix type.
 ///
 /// \param i_matrix The input matrix.
 ///
+/// \return The transposed matrix view.
+template < typename MatrixT >
+constexpr inline TransposeView< MatrixT > Transpose( const MatrixT& i_matrix )
+{
+    return TransposeView< MatrixT >( i_matrix );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// Find the transpose of the temporary \p i_matrix.
+///
+/// A view of a temporary would dangle once it is stored, such as in
+/// \code{.cpp}
+/// auto transpose = linear::Transpose( MakeMatrix() );
+/// \endcode
+/// thus the transpose is materialized into a \ref Matrix.
+///
+/// \param i_matrix The input matrix.
+///
 /// \return The transposed matrix.
 template < typename MatrixT >
-constexpr inline Matrix< MatrixT::ColumnCount(), MatrixT::RowCount(), typename MatrixT::ValueType >
-Transpose( const MatrixT& i_matrix )
+constexpr inline typename TransposeView< MatrixT >::MatrixType Transpose( const MatrixT&& i_matrix )
+{
+    return typename TransposeView< MatrixT >::MatrixType( TransposeView< MatrixT >( i_matrix ) );
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// The transpose of a transposed matrix is the original matrix.
+///
+/// \param i_view The transpose view.
+///
+/// \return The original matrix referenced by \p i_view.
+template < typename MatrixT >
+constexpr inline const MatrixT& Transpose( const TransposeView< MatrixT >& i_view )
+{
+    return i_view.GetMatrix();
+}
+
+/// \overload
+/// \ingroup LinearAlgebra_Operations
+///
+/// The transpose of a temporary transpose view is the original matrix, which the view does not own.
+///
+/// \param i_view The transpose view.
+///
+/// \return The original matrix referenced by \p i_view.
+template < typename MatrixT >
+constexpr inline const MatrixT& Transpose( const TransposeView< MatrixT >&& i_view )
 {
-    return _MatrixTranspose( i_matrix );
+    return i_view.GetMatrix();
 }
 
 LINEAR_NS_CLOSE
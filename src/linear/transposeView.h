@@ -0,0 +1,186 @@
+#pragma once
+
+/// \file transposeView.h
+/// \ingroup LinearAlgebra_Types
+///
+/// A lightweight, read-only view of the transpose of a matrix.
+
+#include <linear/linear.h>
+#include <linear/matrix.h>
+
+#include <linear/base/diagnostic.h>
+#include <linear/base/matrixColumn.h>
+#include <linear/base/matrixRow.h>
+
+LINEAR_NS_OPEN
+
+/// \class TransposeView
+/// \ingroup LinearAlgebra_Types
+///
+/// Class presenting the transpose of a matrix, without copying any of its entries.
+///
+/// Entry access through the view swaps the row and column indices, and forwards to the referenced matrix.
+/// The view can be passed into any operation which accepts a matrix, and is materialized into a \ref Matrix
+/// only upon construction or assignment of one:
+/// \code{.cpp}
+/// linear::Matrix< 3, 2 > matrix;
+/// linear::Matrix< 2, 2 > product   = linear::Multiply( linear::Transpose( matrix ), matrix ); // No copy.
+/// linear::Matrix< 2, 3 > transpose = linear::Transpose( matrix );                            // Materialized.
+/// \endcode
+///
+/// \note The view holds a reference to the source matrix, thus must not outlive it.
+///
+/// \tparam MatrixT the type of the matrix being transposed.
+template < typename MatrixT >
+class TransposeView final
+{
+public:
+    //-------------------------------------------------------------------------
+    /// \name Type definitions
+    //-------------------------------------------------------------------------
+
+    /// \var ValueType
+    ///
+    /// Convenience type definition for the value type of the entries.
+    using ValueType = typename MatrixT::ValueType;
+
+    /// \var MatrixType
+    ///
+    /// The matrix type which this view materializes into.
+    using MatrixType = Matrix< MatrixT::ColumnCount(), MatrixT::RowCount(), ValueType >;
+
+    //-------------------------------------------------------------------------
+    /// \name Construction
+    //-------------------------------------------------------------------------
+
+    /// Construct a transpose view of \p i_matrix.
+    constexpr explicit TransposeView( const MatrixT& i_matrix )
+        : m_matrix( i_matrix )
+    {
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Shape
+    //-------------------------------------------------------------------------
+
+    /// Get the row size of the transposed matrix.
+    ///
+    /// \return The row size.
+    constexpr static inline int RowCount()
+    {
+        return MatrixT::ColumnCount();
+    }
+
+    /// Get the column size of the transposed matrix.
+    ///
+    /// \return The column size.
+    constexpr static inline int ColumnCount()
+    {
+        return MatrixT::RowCount();
+    }
+
+    /// Get the total number of entries in the transposed matrix.
+    ///
+    /// \return The total number of entries.
+    constexpr static inline int EntryCount()
+    {
+        return MatrixT::EntryCount();
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Entry access
+    //-------------------------------------------------------------------------
+
+    /// Transposed matrix entry read-access by row & column indices.
+    ///
+    /// \param i_rowIndex row of the entry to access.
+    /// \param i_colIndex column of the entry to access.
+    ///
+    /// \return Value entry at row \p i_rowIndex and column \p i_colIndex of the transposed matrix.
+    constexpr inline const ValueType& operator()( size_t i_rowIndex, size_t i_colIndex ) const
+    {
+        return m_matrix( i_colIndex, i_rowIndex );
+    }
+
+    /// Transposed matrix entry read-access by single index, with respect to row-major.
+    ///
+    /// \param i_index the index of the entry to access.
+    ///
+    /// \return Value entry at entry \p i_index of the transposed matrix.
+    constexpr inline const ValueType& operator[]( size_t i_index ) const
+    {
+        LINEAR_ASSERT_MSG( i_index < size_t( EntryCount() ), "Requested index %lu exceeds size %lu\n", i_index,
+                           size_t( EntryCount() ) );
+        return m_matrix( i_index % ColumnCount(), i_index / ColumnCount() );
+    }
+
+    /// Extract a single row of the transposed matrix.
+    ///
+    /// \param i_rowIndex the index of the row to extract.
+    ///
+    /// \return the row of the transposed matrix.
+    constexpr inline Matrix< 1, ColumnCount(), ValueType > GetRow( size_t i_rowIndex ) const
+    {
+        LINEAR_ASSERT( i_rowIndex < RowCount() );
+        return _MatrixRow< TransposeView, Matrix< 1, ColumnCount(), ValueType > >( *this, i_rowIndex );
+    }
+
+    /// Extract a single column of the transposed matrix.
+    ///
+    /// \param i_colIndex the index of the column to extract.
+    ///
+    /// \return the column of the transposed matrix.
+    constexpr inline Matrix< RowCount(), 1, ValueType > GetColumn( size_t i_colIndex ) const
+    {
+        LINEAR_ASSERT( i_colIndex < ColumnCount() );
+        return _MatrixColumn< TransposeView, Matrix< RowCount(), 1, ValueType > >( *this, i_colIndex );
+    }
+
+    /// Get the matrix being transposed.
+    ///
+    /// \return the referenced source matrix.
+    constexpr inline const MatrixT& GetMatrix() const
+    {
+        return m_matrix;
+    }
+
+    //-------------------------------------------------------------------------
+    /// \name Comparison operators
+    //-------------------------------------------------------------------------
+
+    /// Equality comparison operator.
+    ///
+    /// \return true if the transposed matrix and \p i_matrix are \em equal.
+    constexpr inline bool operator==( const MatrixType& i_matrix ) const
+    {
+        return MatrixType( *this ) == i_matrix;
+    }
+
+    /// In-equality comparison operator.
+    ///
+    /// \return true if the transposed matrix and \p i_matrix are <em>not equal</em>.
+    constexpr inline bool operator!=( const MatrixType& i_matrix ) const
+    {
+        return !( *this == i_matrix );
+    }
+
+private:
+    /// The matrix being transposed.
+    const MatrixT& m_matrix;
+};
+
+/// Operator overload for << to enable writing the string representation of the transposed matrix into an output
+/// stream \p o_outputStream.
+///
+/// \param o_outputStream the output stream to write into.
+/// \param i_view the transpose view.
+///
+/// \return the output stream.
+template < typename MatrixT >
+inline std::ostream& operator<<( std::ostream& o_outputStream, const TransposeView< MatrixT >& i_view )
+{
+    o_outputStream << typename TransposeView< MatrixT >::MatrixType( i_view ).GetString();
+    return o_outputStream;
+}
+
+LINEAR_NS_CLOSE